@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+"""
+Reconnects to the device repeatedly from one or more fabrics and reports the time each
+chip-tool read takes. Every chip-tool run establishes a new CASE session, which the device
+resumes if it still has the resumption state of the controller.
+
+The device must already be commissioned into every fabric used. Build the firmware with
+CONFIG_APP_CASE_RESUMPTION=y and pass --serial to reset the device statistics before the run
+and collect the device side view ("app resumption show") at the end. With --reboot-every N
+the device is warm reset every N rounds, which shows whether the cache is retained.
+"""
+
+import argparse
+import statistics
+import subprocess
+import sys
+import time
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--chip-tool", default="chip-tool", help="Path to the chip-tool binary")
+    parser.add_argument("--node-id", type=int, required=True, help="Node ID of the device in every fabric")
+    parser.add_argument("--fabrics", default="alpha", help="Comma separated commissioner names")
+    parser.add_argument("--rounds", type=int, default=20, help="Number of reconnections per fabric")
+    parser.add_argument("--interval", type=float, default=1.0, help="Pause between reconnections [s]")
+    parser.add_argument("--reboot-every", type=int, default=0, help="Warm reset the device every N rounds")
+    parser.add_argument("--serial", help="Device shell serial port used to collect device statistics")
+    return parser.parse_args()
+
+
+def device_shell(port, command, wait=1):
+    import serial
+
+    with serial.Serial(port, 115200, timeout=1) as uart:
+        uart.write(f"{command}\r\n".encode())
+        time.sleep(wait)
+        return uart.read(uart.in_waiting or 1).decode(errors="replace")
+
+
+def reconnect(chip_tool, node_id, fabric):
+    start = time.monotonic()
+    result = subprocess.run([chip_tool, "basicinformation", "read", "vendor-id", str(node_id), "0",
+                             "--commissioner-name", fabric], stdout=subprocess.DEVNULL,
+                            stderr=subprocess.DEVNULL, check=False)
+    return time.monotonic() - start, result.returncode == 0
+
+
+def main():
+    args = parse_args()
+    fabrics = args.fabrics.split(",")
+    times = {fabric: [] for fabric in fabrics}
+    failures = 0
+
+    if args.serial:
+        device_shell(args.serial, "app resumption reset")
+
+    for round_index in range(args.rounds):
+        if args.serial and args.reboot_every and round_index and round_index % args.reboot_every == 0:
+            device_shell(args.serial, "kernel reboot warm", wait=15)
+
+        for fabric in fabrics:
+            duration, ok = reconnect(args.chip_tool, args.node_id, fabric)
+            if ok:
+                times[fabric].append(duration)
+            else:
+                failures += 1
+            time.sleep(args.interval)
+
+    print(f"{'fabric':<8} {'reads':<6} {'avg_ms':<8} {'median_ms':<10} {'max_ms':<8}")
+    for fabric, samples in times.items():
+        if not samples:
+            print(f"{fabric:<8} {0:<6}")
+            continue
+        print(f"{fabric:<8} {len(samples):<6} {statistics.mean(samples) * 1000:<8.0f} "
+              f"{statistics.median(samples) * 1000:<10.0f} {max(samples) * 1000:<8.0f}")
+    print(f"failed reads: {failures}")
+
+    if args.serial:
+        print(device_shell(args.serial, "app resumption show"))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,269 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+"""
+Attributes the flash (ROM) and RAM used by the final image to Matter clusters, application
+modules and SDK libraries, and compares the result with a stored baseline.
+
+The input sections listed in the linker map of the final link (zephyr.map) are grouped by the
+object file they come from:
+
+  cluster/<name>  cluster server and client implementations compiled into the application, by the
+                  source directories listed for the cluster in zap_cluster_list.json of the Matter SDK
+  app/<name>      modules of this application (src/)
+  common/<name>   other application objects, such as the Matter data model and common sample code
+  lib/<name>      SDK, Matter and toolchain libraries, by archive
+
+Initialized data is counted in both ROM and RAM. Run the "footprint" build target to compare the
+image with the baseline of the board and "footprint_baseline" to update the baseline. The
+comparison fails when a group grows by more than --threshold bytes, and with --require-baseline
+also when the board has no baseline.
+"""
+
+import argparse
+import collections
+import json
+import os
+import re
+import sys
+
+MEMORY_RE = re.compile(r"^(\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s*(\S*)")
+OUTPUT_SECTION_RE = re.compile(r"^([^\s*]\S*)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(.*))?$")
+INPUT_SECTION_RE = re.compile(r"^ (\S+)?\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$")
+MEMBER_RE = re.compile(r"([^/\\]+)\.a\(([^)]+)\)$")
+
+NOT_ALLOCATED = (".debug", ".comment", ".ARM.attributes", ".stab", ".symtab", ".strtab", ".shstrtab", "/DISCARD/")
+SOURCE_SUFFIXES = (".c", ".cpp")
+
+APP_SOURCES = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src")
+
+
+class Region:
+    def __init__(self, name, origin, length, writable):
+        self.name = name
+        self.origin = origin
+        self.end = origin + length
+        self.writable = writable
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--map", required=True, help="Linker map of the final image (zephyr.map)")
+    parser.add_argument("--matter-root", required=True, help="Matter SDK root, with src/app/zap_cluster_list.json")
+    parser.add_argument("--baseline", help="Baseline JSON file to compare with")
+    parser.add_argument("--require-baseline", action="store_true", help="Fail when the baseline file does not exist")
+    parser.add_argument("--update-baseline", action="store_true", help="Write the report to the baseline file")
+    parser.add_argument("--threshold", type=int, default=256, help="Allowed growth of a group [B]")
+    parser.add_argument("--top", type=int, default=30, help="Number of the largest groups printed")
+    parser.add_argument("--json", help="Also write the report to this file")
+    return parser.parse_args()
+
+
+def app_modules():
+    try:
+        return {os.path.splitext(name)[0] for name in os.listdir(APP_SOURCES) if name.endswith((".c", ".cpp"))}
+    except OSError:
+        return set()
+
+
+def cluster_sources(matter_root):
+    """Maps the source file stems of the cluster implementations to the cluster names."""
+    app_dir = os.path.join(matter_root, "src", "app")
+    with open(os.path.join(app_dir, "zap_cluster_list.json")) as list_file:
+        cluster_list = json.load(list_file)
+
+    clusters = collections.defaultdict(set)
+    for directories in (cluster_list.get("ServerDirectories", {}), cluster_list.get("ClientDirectories", {})):
+        for define, dirs in directories.items():
+            name = define.removesuffix("_CLUSTER").lower().replace("_", "-")
+            for directory in dirs:
+                clusters[directory].add(name)
+
+    sources = {}
+    for directory, names in clusters.items():
+        # Directories shared by several clusters, such as concentration-measurement-server, keep their name.
+        name = next(iter(names)) if len(names) == 1 else directory
+        for root, _, files in os.walk(os.path.join(app_dir, "clusters", directory)):
+            for file_name in files:
+                if file_name.endswith(SOURCE_SUFFIXES):
+                    sources[os.path.splitext(file_name)[0]] = name
+
+    return sources
+
+
+def classify(source, modules, clusters):
+    match = MEMBER_RE.search(source)
+    if not match:
+        # Objects linked directly, such as the startup and the generated linker inputs.
+        return "lib/" + os.path.basename(source).split(".")[0] if source else "lib/linker"
+
+    archive, member = match.groups()
+    stem = member.split(".")[0]
+
+    if archive != "libapp":
+        return "lib/" + archive[3:] if archive.startswith("lib") else "lib/" + archive
+    if stem in modules:
+        return "app/" + stem
+    if stem in clusters:
+        return "cluster/" + clusters[stem]
+    return "common/" + stem
+
+
+def parse_map(path, clusters):
+    regions = []
+    groups = collections.defaultdict(lambda: [0, 0])
+    modules = app_modules()
+    output_section = None
+    copied = False
+    pending_name = None
+    in_memory = False
+    in_layout = False
+
+    with open(path, errors="replace") as map_file:
+        for line in map_file:
+            line = line.rstrip("\n")
+
+            if line.startswith("Memory Configuration"):
+                in_memory = True
+                continue
+            if line.startswith("Linker script and memory map"):
+                in_memory = False
+                in_layout = True
+                continue
+
+            if in_memory:
+                match = MEMORY_RE.match(line)
+                if match and match.group(1) not in ("Name", "*default*"):
+                    regions.append(Region(match.group(1), int(match.group(2), 16), int(match.group(3), 16),
+                                          "w" in match.group(4)))
+                continue
+
+            if not in_layout or not line:
+                continue
+
+            if not line.startswith(" "):
+                match = OUTPUT_SECTION_RE.match(line)
+                if match:
+                    output_section = match.group(1)
+                    copied = "load address" in (match.group(4) or "")
+                continue
+
+            if output_section is None or output_section.startswith(NOT_ALLOCATED):
+                continue
+
+            # Long input section names are followed by the address, size and object on the next line.
+            if re.match(r"^ \S+$", line):
+                pending_name = line.strip()
+                continue
+
+            match = INPUT_SECTION_RE.match(line)
+            name = match.group(1) if match else None
+            if not match or (name is None and pending_name is None):
+                pending_name = None
+                continue
+
+            pending_name = None
+            address = int(match.group(2), 16)
+            size = int(match.group(3), 16)
+            if size == 0:
+                continue
+
+            region = next((r for r in regions if r.origin <= address < r.end), None)
+            if region is None:
+                continue
+
+            group = groups[classify(match.group(4).strip(), modules, clusters)]
+            if region.writable:
+                group[1] += size
+                if copied:
+                    group[0] += size
+            else:
+                group[0] += size
+
+    return {name: {"rom": rom, "ram": ram} for name, (rom, ram) in groups.items()}
+
+
+def category_totals(report):
+    totals = collections.defaultdict(lambda: {"rom": 0, "ram": 0})
+    for name, usage in report.items():
+        category = name.split("/")[0]
+        totals[category]["rom"] += usage["rom"]
+        totals[category]["ram"] += usage["ram"]
+    return totals
+
+
+def print_report(report, baseline, top):
+    def delta(name, kind, value, reference):
+        if reference is None:
+            return ""
+        old = reference.get(name, {}).get(kind, 0)
+        return f"{value - old:+d}" if value != old else ""
+
+    print(f"{'group':<40} {'rom':>8} {'delta':>7} {'ram':>8} {'delta':>7}")
+
+    largest = sorted(report.items(), key=lambda item: item[1]["rom"] + item[1]["ram"], reverse=True)
+    for name, usage in largest[:top]:
+        print(f"{name:<40} {usage['rom']:>8} {delta(name, 'rom', usage['rom'], baseline):>7} "
+              f"{usage['ram']:>8} {delta(name, 'ram', usage['ram'], baseline):>7}")
+
+    print()
+    base_totals = category_totals(baseline) if baseline is not None else None
+    for category, usage in sorted(category_totals(report).items()):
+        print(f"{category + ' (total)':<40} {usage['rom']:>8} {delta(category, 'rom', usage['rom'], base_totals):>7} "
+              f"{usage['ram']:>8} {delta(category, 'ram', usage['ram'], base_totals):>7}")
+
+
+def compare(report, baseline, threshold):
+    regressions = []
+
+    for name in sorted(set(report) | set(baseline)):
+        for kind in ("rom", "ram"):
+            growth = report.get(name, {}).get(kind, 0) - baseline.get(name, {}).get(kind, 0)
+            if growth > threshold:
+                regressions.append(f"{name}: {kind} grew by {growth} B")
+
+    return regressions
+
+
+def main():
+    args = parse_args()
+    report = parse_map(args.map, cluster_sources(args.matter_root))
+
+    if not report:
+        print(f"No allocated input sections found in {args.map}", file=sys.stderr)
+        return 1
+
+    baseline = None
+    if args.baseline and os.path.exists(args.baseline) and not args.update_baseline:
+        with open(args.baseline) as baseline_file:
+            baseline = json.load(baseline_file)
+
+    print_report(report, baseline, args.top)
+
+    for path in filter(None, (args.json, args.baseline if args.update_baseline else None)):
+        os.makedirs(os.path.dirname(os.path.abspath(path)), exist_ok=True)
+        with open(path, "w") as output:
+            json.dump(report, output, indent=2, sort_keys=True)
+            output.write("\n")
+        print(f"Written {path}")
+
+    if baseline is None:
+        if args.baseline and not args.update_baseline:
+            print(f"No baseline in {args.baseline}, run the footprint_baseline target to create it",
+                  file=sys.stderr if args.require_baseline else sys.stdout)
+            return 1 if args.require_baseline else 0
+        return 0
+
+    regressions = compare(report, baseline, args.threshold)
+    for regression in regressions:
+        print(f"error: {regression}", file=sys.stderr)
+
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+"""
+Produces compressed and delta encoded application image payloads accepted by the OTA payload
+decoder (CONFIG_APP_OTA_COMPRESSION, CONFIG_APP_OTA_DELTA), and compares the payload sizes.
+
+The input images are signed MCUboot images, for example build/template/zephyr/zephyr.signed.bin.
+A delta is made against the image currently running on the device, which must be the exact
+signed image it was built from. The payload replaces the application image when creating the
+multi-image package:
+
+    ota_payload.py delta --base old.signed.bin --compress new.signed.bin app.payload
+    dfu_multi_image_tool.py create --image 0 app.payload dfu_multi_image.bin
+    ota_image_tool.py create -v 0xFFF1 -p 0x8000 -vn 2 -vs 2.0 -da sha256 dfu_multi_image.bin matter.ota
+"""
+
+import argparse
+import hashlib
+import lzma
+import struct
+import sys
+import time
+
+MAGIC = 0x41544f41
+VERSION = 1
+FLAG_COMPRESSED = 0x01
+FLAG_DELTA = 0x02
+HEADER = struct.Struct("<IBBHII32s")
+
+OP_COPY = 0x01
+OP_INSERT = 0x02
+
+# Matches the defaults of the nRF Connect SDK decompressor, which expects the LZMA2 properties
+# in front of the raw stream.
+LZMA_PB = 2
+LZMA_LC = 3
+LZMA_LP = 1
+
+
+def lzma2_header(dict_size):
+    for i in range(40):
+        if dict_size <= ((2 | (i & 1)) << (i // 2 + 11)):
+            return bytes([i, (LZMA_PB * 5 + LZMA_LP) * 9 + LZMA_LC])
+    raise ValueError("dictionary size too large")
+
+
+def compress(data, dict_size):
+    filters = [{"id": lzma.FILTER_LZMA2, "preset": 9 | lzma.PRESET_EXTREME, "dict_size": dict_size,
+                "pb": LZMA_PB, "lc": LZMA_LC, "lp": LZMA_LP}]
+    return lzma2_header(dict_size) + lzma.compress(data, format=lzma.FORMAT_RAW, filters=filters)
+
+
+def make_delta(base, image, block_size, min_match):
+    """
+    Encodes the image as copies of base image ranges and inserted literals. The base is indexed
+    by blocks starting at every 4th byte, which matches the instruction alignment well enough to
+    find code that only moved.
+    """
+    index = {}
+    for offset in range(0, len(base) - block_size + 1, 4):
+        index.setdefault(base[offset:offset + block_size], offset)
+
+    delta = bytearray()
+    literal = bytearray()
+    position = 0
+
+    def flush_literal():
+        if literal:
+            delta.extend(struct.pack("<BI", OP_INSERT, len(literal)))
+            delta.extend(literal)
+            literal.clear()
+
+    while position < len(image):
+        source = index.get(image[position:position + block_size])
+        length = 0
+
+        if source is not None:
+            while (position + length < len(image) and source + length < len(base) and
+                   image[position + length] == base[source + length]):
+                length += 1
+
+        if length >= min_match:
+            flush_literal()
+            delta.extend(struct.pack("<BII", OP_COPY, source, length))
+            position += length
+        else:
+            literal.append(image[position])
+            position += 1
+
+    flush_literal()
+    return bytes(delta)
+
+
+def encode(image, base=None, compressed=False, dict_size=32 * 1024, block_size=32, min_match=32):
+    flags = 0
+    body = image
+    base_size = 0
+    base_digest = bytes(32)
+
+    if base is not None:
+        flags |= FLAG_DELTA
+        body = make_delta(base, image, block_size, min_match)
+        base_size = len(base)
+        base_digest = hashlib.sha256(base).digest()
+
+    if compressed:
+        flags |= FLAG_COMPRESSED
+        body = compress(body, dict_size)
+
+    return HEADER.pack(MAGIC, VERSION, flags, 0, len(image), base_size, base_digest) + body
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--dict-size", type=int, default=32 * 1024, help="LZMA2 dictionary size [B]")
+    subparsers = parser.add_subparsers(dest="command", required=True)
+
+    compress_parser = subparsers.add_parser("compress", help="Compress an image")
+    compress_parser.add_argument("image", help="New signed image")
+    compress_parser.add_argument("output", help="Output payload")
+
+    delta_parser = subparsers.add_parser("delta", help="Encode an image as a delta")
+    delta_parser.add_argument("--base", required=True, help="Signed image running on the device")
+    delta_parser.add_argument("--compress", action="store_true", help="Compress the delta")
+    delta_parser.add_argument("--block-size", type=int, default=32, help="Base index block size [B]")
+    delta_parser.add_argument("image", help="New signed image")
+    delta_parser.add_argument("output", help="Output payload")
+
+    bench_parser = subparsers.add_parser("bench", help="Compare the payload sizes of all encodings")
+    bench_parser.add_argument("--base", help="Signed image running on the device")
+    bench_parser.add_argument("--throughput", type=float, default=2.0,
+                              help="Effective BDX throughput used to estimate the transfer time [KiB/s]")
+    bench_parser.add_argument("image", help="New signed image")
+
+    return parser.parse_args()
+
+
+def bench(args, image, base):
+    variants = [("full", dict()), ("lzma2", dict(compressed=True))]
+    if base is not None:
+        variants += [("delta", dict(base=base)), ("delta+lzma2", dict(base=base, compressed=True))]
+
+    print(f"{'encoding':<12} {'size [B]':>10} {'ratio':>7} {'transfer [s]':>13} {'encode [s]':>11}")
+    for name, options in variants:
+        start = time.monotonic()
+        payload = image if name == "full" else encode(image, dict_size=args.dict_size, **options)
+        elapsed = time.monotonic() - start
+        transfer = len(payload) / (args.throughput * 1024)
+        print(f"{name:<12} {len(payload):>10} {len(payload) / len(image):>7.3f} {transfer:>13.0f} {elapsed:>11.1f}")
+
+    print("The apply time is logged by the device after the download (\"OTA payload: ... decoded\").")
+
+
+def main():
+    args = parse_args()
+
+    with open(args.image, "rb") as f:
+        image = f.read()
+
+    base = None
+    if getattr(args, "base", None):
+        with open(args.base, "rb") as f:
+            base = f.read()
+
+    if args.command == "bench":
+        bench(args, image, base)
+        return 0
+
+    if args.command == "compress":
+        payload = encode(image, compressed=True, dict_size=args.dict_size)
+    else:
+        payload = encode(image, base=base, compressed=args.compress, dict_size=args.dict_size,
+                         block_size=args.block_size, min_match=args.block_size)
+
+    with open(args.output, "wb") as f:
+        f.write(payload)
+
+    print(f"{args.image}: {len(image)} B -> {args.output}: {len(payload)} B")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+"""
+Generates the Matter pool sizes of src/chip_project_config.h from the pool usage measured on
+the device during load tests.
+
+Build the firmware with CONFIG_APP_POOL_STATS=y, run the load tests (for example
+subscription_load.py and case_reconnect.py) and save the output of "app pools show" to a file,
+or pass --serial to read it from the device. Several files can be given, the highest peak of
+every pool is used. Each pool is sized to its peak plus the headroom, and never below the
+minimum required by the Matter specification for the supported number of fabrics.
+
+Pools that were exhausted during a test are only known to need at least their current size, so
+they are grown by the headroom and reported, and the test should be repeated.
+"""
+
+import argparse
+import math
+import re
+import sys
+import time
+
+POOL_RE = re.compile(r"^\s*(CHIP_\w+)\s+(\d+)\s+(\d+)\s+(\d+)\s*$")
+
+BEGIN_MARKER = "/* Pool sizes generated by scripts/pool_config.py from the measured usage. */"
+END_MARKER = "/* End of the generated pool sizes. */"
+
+
+def minimum_sizes(fabrics):
+    # Every fabric must be able to hold 3 subscriptions and 1 read interaction at a time, and
+    # the device must accept a CASE session from each fabric plus a PASE session.
+    return {
+        "CHIP_IM_MAX_NUM_SUBSCRIPTIONS": 3 * fabrics,
+        "CHIP_IM_MAX_NUM_READS": fabrics,
+        "CHIP_CONFIG_SECURE_SESSION_POOL_SIZE": fabrics + 1,
+        "CHIP_IM_MAX_NUM_WRITE_HANDLER": 1,
+    }
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("logs", nargs="*", help="Files with the output of \"app pools show\"")
+    parser.add_argument("--serial", help="Device shell serial port to read the pool usage from")
+    parser.add_argument("--headroom", type=float, default=25.0, help="Headroom over the peak usage [%%]")
+    parser.add_argument("--min-spare", type=int, default=1, help="Minimum number of spare objects per pool")
+    parser.add_argument("--fabrics", type=int, default=5, help="Number of supported fabrics")
+    parser.add_argument("--config", default="src/chip_project_config.h", help="Project configuration to update")
+    parser.add_argument("--dry-run", action="store_true", help="Print the generated block instead of writing it")
+    return parser.parse_args()
+
+
+def device_shell(port, command, wait=1):
+    import serial
+
+    with serial.Serial(port, 115200, timeout=1) as uart:
+        uart.write(f"{command}\r\n".encode())
+        time.sleep(wait)
+        return uart.read(uart.in_waiting or 1).decode(errors="replace")
+
+
+def parse_usage(text, pools):
+    for line in text.splitlines():
+        match = POOL_RE.match(line)
+        if not match:
+            continue
+        macro, _, peak, size = match.group(1), *map(int, match.groups()[1:])
+        old_peak, old_size = pools.get(macro, (0, size))
+        pools[macro] = (max(peak, old_peak), old_size)
+
+
+def generate(pools, args):
+    minimums = minimum_sizes(args.fabrics)
+    lines = [BEGIN_MARKER]
+    exhausted = []
+
+    for macro, (peak, size) in sorted(pools.items()):
+        if peak >= size:
+            exhausted.append(macro)
+        tuned = max(math.ceil(peak * (1 + args.headroom / 100)), peak + args.min_spare, minimums.get(macro, 1))
+        lines.append(f"/* Peak usage {peak} of {size}. */")
+        lines.append(f"#define {macro} {tuned}")
+
+    lines.append(END_MARKER)
+    return "\n".join(lines) + "\n", exhausted
+
+
+def update_config(path, block):
+    with open(path) as config:
+        content = config.read()
+
+    if BEGIN_MARKER in content:
+        start = content.index(BEGIN_MARKER)
+        end = content.index(END_MARKER, start) + len(END_MARKER) + 1
+        content = content[:start] + block + content[end:]
+    else:
+        content = content.rstrip("\n") + "\n\n" + block
+
+    with open(path, "w") as config:
+        config.write(content)
+
+
+def main():
+    args = parse_args()
+    pools = {}
+
+    for log in args.logs:
+        with open(log) as log_file:
+            parse_usage(log_file.read(), pools)
+
+    if args.serial:
+        parse_usage(device_shell(args.serial, "app pools show"), pools)
+
+    if not pools:
+        print("No pool usage found, pass the output of \"app pools show\" or --serial", file=sys.stderr)
+        return 1
+
+    block, exhausted = generate(pools, args)
+
+    for macro in exhausted:
+        print(f"warning: {macro} was exhausted during the test, repeat it with the new size", file=sys.stderr)
+
+    if args.dry_run:
+        print(block, end="")
+    else:
+        update_config(args.config, block)
+        print(f"Updated {args.config}")
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+"""
+Opens N subscriptions to the measurement clusters on endpoint 1, spread over M fabrics and
+a range of min/max intervals, and reports per-subscription report counts and late reports
+as seen by the controllers.
+
+The device must already be commissioned into every fabric used (chip-tool commissioner
+names, for example alpha, beta, gamma). Build the firmware with CONFIG_APP_REPORT_STATS=y and
+pass --serial to collect the device side view ("app reports show") at the end of the run. With
+CONFIG_APP_REPORT_STATS_MESSAGES=y the summary also lists the messages sent and received per fabric.
+"""
+
+import argparse
+import itertools
+import random
+import re
+import subprocess
+import sys
+import threading
+import time
+
+CLUSTERS = [("temperaturemeasurement", "measured-value"),
+            ("relativehumiditymeasurement", "measured-value")]
+
+ESTABLISHED_RE = re.compile(
+    r"Subscription established with SubscriptionID = (0x[0-9a-fA-F]+) MinInterval = (\d+)s MaxInterval = (\d+)s")
+REPORT_RE = re.compile(r"SubscriptionId = (0x[0-9a-fA-F]+)")
+MESSAGES_RE = re.compile(r"messages: (fabric \d+|no fabric), sent (\d+), received (\d+)")
+
+
+class Subscription:
+    def __init__(self, fabric, min_interval, max_interval):
+        self.fabric = fabric
+        self.min_interval = min_interval
+        self.max_interval = max_interval
+        self.reports = 0
+        self.late = 0
+        self.last_report = None
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--chip-tool", default="chip-tool", help="Path to the chip-tool binary")
+    parser.add_argument("--node-id", type=int, required=True, help="Node ID of the device in every fabric")
+    parser.add_argument("--fabrics", default="alpha,beta,gamma", help="Comma separated commissioner names")
+    parser.add_argument("--subscriptions", type=int, default=5, help="Total number of subscriptions")
+    parser.add_argument("--min-interval", default="0,10", help="Range of the minimum interval [s]")
+    parser.add_argument("--max-interval", default="10,60", help="Range of the maximum interval [s]")
+    parser.add_argument("--duration", type=int, default=600, help="Test duration [s]")
+    parser.add_argument("--late-margin", type=float, default=2.0, help="Late report margin [s]")
+    parser.add_argument("--seed", type=int, default=0, help="Random seed for the interval selection")
+    parser.add_argument("--serial", help="Device shell serial port used to collect device statistics")
+    return parser.parse_args()
+
+
+def parse_range(value):
+    low, high = (int(v) for v in value.split(","))
+    return low, high
+
+
+def device_shell(port, command):
+    import serial
+
+    with serial.Serial(port, 115200, timeout=1) as uart:
+        uart.write(f"{command}\r\n".encode())
+        time.sleep(1)
+        return uart.read(uart.in_waiting or 1).decode(errors="replace")
+
+
+def main():
+    args = parse_args()
+    rng = random.Random(args.seed)
+    fabrics = args.fabrics.split(",")
+    min_range = parse_range(args.min_interval)
+    max_range = parse_range(args.max_interval)
+
+    if args.serial:
+        device_shell(args.serial, "app reports reset")
+
+    tool = subprocess.Popen([args.chip_tool, "interactive", "start"], stdin=subprocess.PIPE,
+                            stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True, bufsize=1)
+    subscriptions = {}
+    requested = []
+    lock = threading.Lock()
+
+    def reader():
+        for line in tool.stdout:
+            now = time.monotonic()
+            match = ESTABLISHED_RE.search(line)
+            if match:
+                with lock:
+                    if requested:
+                        fabric = requested.pop(0)
+                        subscriptions[match.group(1)] = Subscription(fabric, int(match.group(2)),
+                                                                     int(match.group(3)))
+                continue
+            match = REPORT_RE.search(line)
+            if match:
+                with lock:
+                    sub = subscriptions.get(match.group(1))
+                    if sub is None:
+                        continue
+                    if sub.last_report is not None and \
+                            now - sub.last_report > sub.max_interval + args.late_margin:
+                        sub.late += 1
+                    sub.reports += 1
+                    sub.last_report = now
+
+    threading.Thread(target=reader, daemon=True).start()
+
+    for index, fabric in zip(range(args.subscriptions), itertools.cycle(fabrics)):
+        cluster, attribute = CLUSTERS[index % len(CLUSTERS)]
+        min_interval = rng.randint(*min_range)
+        max_interval = max(min_interval, rng.randint(*max_range))
+        with lock:
+            requested.append(fabric)
+        tool.stdin.write(f"{cluster} subscribe {attribute} {min_interval} {max_interval} {args.node_id} 1 "
+                         f"--commissioner-name {fabric} --keepSubscriptions true\n")
+        tool.stdin.flush()
+        time.sleep(2)
+
+    time.sleep(args.duration)
+    tool.stdin.write("quit()\n")
+    tool.stdin.flush()
+    tool.terminate()
+
+    with lock:
+        print(f"{'id':<12} {'fabric':<8} {'min/max':<9} {'reports':<8} {'late':<5}")
+        for sub_id, sub in subscriptions.items():
+            print(f"{sub_id:<12} {sub.fabric:<8} {sub.min_interval:>4}/{sub.max_interval:<4} "
+                  f"{sub.reports:<8} {sub.late:<5}")
+        missing = args.subscriptions - len(subscriptions)
+        print(f"established {len(subscriptions)}/{args.subscriptions}, not established {missing}")
+
+    if args.serial:
+        output = device_shell(args.serial, "app reports show")
+        print(output)
+
+        messages = MESSAGES_RE.findall(output)
+        if messages:
+            print(f"{'fabric':<12} {'sent':<8} {'received':<8}")
+            for fabric, sent, received in messages:
+                print(f"{fabric:<12} {sent:<8} {received:<8}")
+            print(f"messages sent {sum(int(m[1]) for m in messages)}, "
+                  f"received {sum(int(m[2]) for m in messages)}")
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
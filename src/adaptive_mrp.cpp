@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "adaptive_mrp.h"
+
+#include <app/server/Server.h>
+#include <matter/tracing/build_config.h>
+#include <tracing/registry.h>
+#include <transport/SecureSession.h>
+#include <transport/TracingStructs.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/shell/shell.h>
+
+#if !MATTER_TRACING_ENABLED
+#error "CONFIG_APP_MRP_ADAPTIVE requires the Matter library to be built with tracing support"
+#endif
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+using namespace ::chip::Tracing;
+
+CHIP_ERROR AdaptiveMrp::Init()
+{
+#if APP_MRP_ANALYTICS_AVAILABLE
+	ReturnErrorOnFailure(MrpAnalytics::Instance().AddListener(*this));
+	Register(*this);
+#else
+	/* A sample taken across an unnoticed retransmission would inflate the estimate, so none is taken. */
+	LOG_WRN("MRP analytics not supported by the Matter library, adaptive MRP disabled");
+#endif
+
+	return CHIP_NO_ERROR;
+}
+
+void AdaptiveMrp::LogMessageSend(MessageSendInfo &info)
+{
+	if (info.messageType != OutgoingMessageType::kSecureSession || !info.payloadHeader->NeedsAck()) {
+		return;
+	}
+
+	if (!mSampler.Track(info.packetHeader->GetSessionId(), info.packetHeader->GetMessageCounter(),
+			    k_uptime_get_32())) {
+		mCounters.mPendingOverflows++;
+	}
+
+	mCounters.mTracked++;
+}
+
+#if APP_MRP_ANALYTICS_AVAILABLE
+void AdaptiveMrp::OnTransmitEvent(const TransmitEvent &event)
+{
+	/* Retransmissions are sent again as prepared, without going through the tracing of the messages sent. */
+	if (event.eventType == EventType::kRetransmission) {
+		if (mSampler.MarkRetransmitted(event.messageCounter)) {
+			mCounters.mRetransmissions++;
+		}
+	} else if (event.eventType == EventType::kFailed) {
+		mSampler.Release(event.messageCounter);
+	}
+}
+#endif /* APP_MRP_ANALYTICS_AVAILABLE */
+
+void AdaptiveMrp::LogMessageReceived(MessageReceivedInfo &info)
+{
+	if (info.messageType != IncomingMessageType::kSecureUnicast || info.session == nullptr ||
+	    info.session->GetSessionType() != Transport::Session::SessionType::kSecure) {
+		return;
+	}
+
+	const Transport::SecureSession *session = info.session->AsConstSecureSession();
+	const ReliableMessageProtocolConfig &config = session->GetRemoteMRPConfig();
+	Peer *known = LookupPeer(session->GetPeer());
+
+	/*
+	 * A new session with a known peer starts with the parameters advertised by the peer, the estimate is applied to
+	 * it as soon as the session carries its first message.
+	 */
+	if (known != nullptr && known->mEstimator.Samples() >= APP_MRP_ADAPTIVE_MIN_SAMPLES &&
+	    config.mActiveRetransTimeout.count() != known->mAppliedActiveMs) {
+		mCounters.mNewSessions++;
+		Configure(*known);
+	}
+
+	if (!info.payloadHeader->GetAckMessageCounter().HasValue()) {
+		return;
+	}
+
+	uint32_t ackCounter = info.payloadHeader->GetAckMessageCounter().Value();
+	uint32_t rttMs;
+
+	if (!mSampler.Acknowledge(session->GetPeerSessionId(), ackCounter, k_uptime_get_32(), rttMs)) {
+		return;
+	}
+
+	Peer *peer = known ? known
+			   : FindPeer(session->GetPeer(), config.mIdleRetransTimeout.count(),
+				      config.mActiveRetransTimeout.count());
+
+	if (peer != nullptr) {
+		peer->mEstimator.AddSample(rttMs);
+		mCounters.mSamples++;
+		Apply(*peer);
+	}
+}
+
+AdaptiveMrp::Peer *AdaptiveMrp::LookupPeer(const ScopedNodeId &nodeId)
+{
+	for (Peer &peer : mPeers) {
+		if (peer.mInUse && peer.mNodeId == nodeId) {
+			peer.mLastUsedMs = k_uptime_get_32();
+			return &peer;
+		}
+	}
+
+	return nullptr;
+}
+
+AdaptiveMrp::Peer *AdaptiveMrp::FindPeer(const ScopedNodeId &nodeId, uint32_t advertisedIdleMs,
+					 uint32_t advertisedActiveMs)
+{
+	Peer *lru = LookupPeer(nodeId);
+
+	if (lru != nullptr) {
+		return lru;
+	}
+
+	for (Peer &peer : mPeers) {
+		if (lru == nullptr || !peer.mInUse || (lru->mInUse && peer.mLastUsedMs < lru->mLastUsedMs)) {
+			lru = &peer;
+		}
+	}
+
+	if (lru->mInUse) {
+		mCounters.mPeerOverflows++;
+	}
+
+	/* The parameters advertised by the peer are only known before they are overridden for the first time. */
+	lru->mInUse = true;
+	lru->mNodeId = nodeId;
+	lru->mAdvertisedIdleMs = advertisedIdleMs;
+	lru->mAdvertisedActiveMs = advertisedActiveMs;
+	lru->mAppliedActiveMs = advertisedActiveMs;
+	lru->mLastUsedMs = k_uptime_get_32();
+	lru->mEstimator.Reset();
+
+	return lru;
+}
+
+void AdaptiveMrp::Apply(Peer &peer)
+{
+	if (peer.mEstimator.Samples() < APP_MRP_ADAPTIVE_MIN_SAMPLES) {
+		return;
+	}
+
+	uint32_t active =
+		peer.mEstimator.RtoMs(APP_MRP_ADAPTIVE_MIN_RETRY_INTERVAL_MS, APP_MRP_ADAPTIVE_MAX_RETRY_INTERVAL_MS);
+	uint32_t change = active > peer.mAppliedActiveMs ? active - peer.mAppliedActiveMs
+							 : peer.mAppliedActiveMs - active;
+
+	/* Avoid rewriting the session parameters for every small fluctuation. */
+	if (change * 100 < peer.mAppliedActiveMs * APP_MRP_ADAPTIVE_UPDATE_THRESHOLD_PERCENT) {
+		return;
+	}
+
+	peer.mAppliedActiveMs = active;
+	mCounters.mUpdates++;
+
+	Configure(peer);
+}
+
+void AdaptiveMrp::Configure(const Peer &peer)
+{
+	Server::GetInstance().GetSecureSessionManager().ForEachMatchingSession(
+		peer.mNodeId, [&peer](Transport::SecureSession *session) {
+			SessionParameters params = session->GetRemoteSessionParameters();
+			ReliableMessageProtocolConfig config = params.GetMRPConfig();
+
+			/* A sleepy peer must still be given the time it needs to wake up. */
+			config.mActiveRetransTimeout = System::Clock::Milliseconds32(peer.mAppliedActiveMs);
+			config.mIdleRetransTimeout =
+				System::Clock::Milliseconds32(MAX(peer.mAdvertisedIdleMs, peer.mAppliedActiveMs));
+			params.SetMRPConfig(config);
+			session->SetRemoteSessionParameters(params);
+		});
+}
+
+#ifdef CONFIG_SHELL
+void AdaptiveMrp::Print(const struct shell *shell)
+{
+	shell_print(shell, "%-18s %-8s %-8s %-8s %-10s %-10s", "peer", "samples", "srtt", "rttvar", "advertised",
+		    "applied");
+
+	for (const Peer &peer : mPeers) {
+		if (!peer.mInUse) {
+			continue;
+		}
+
+		shell_print(shell, "%u:%08x%08x %-8u %-8u %-8u %-10u %-10u", peer.mNodeId.GetFabricIndex(),
+			    static_cast<uint32_t>(peer.mNodeId.GetNodeId() >> 32),
+			    static_cast<uint32_t>(peer.mNodeId.GetNodeId()), peer.mEstimator.Samples(),
+			    peer.mEstimator.SrttMs(), peer.mEstimator.RttvarMs(), peer.mAdvertisedActiveMs,
+			    peer.mAppliedActiveMs);
+	}
+
+	shell_print(shell, "tracked %u, samples %u, retransmissions %u, updates %u, new sessions %u",
+		    mCounters.mTracked, mCounters.mSamples, mCounters.mRetransmissions, mCounters.mUpdates,
+		    mCounters.mNewSessions);
+	shell_print(shell, "pending overflows %u, peer overflows %u", mCounters.mPendingOverflows,
+		    mCounters.mPeerOverflows);
+}
+
+static int AdaptiveMrpShowHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::StackLock lock;
+
+	AdaptiveMrp::Instance().Print(shell);
+	return 0;
+}
+
+SHELL_SUBCMD_ADD((app), mrp, NULL, "Print adaptive MRP state", AdaptiveMrpShowHandler, 1, 0);
+#endif /* CONFIG_SHELL */
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include "mrp_analytics.h"
+#include "rtt_estimator.h"
+
+#include <lib/core/ScopedNodeId.h>
+#include <tracing/backend.h>
+
+struct shell;
+
+/*
+ * Adapts the MRP retransmission intervals used towards each peer to the round-trip time measured on its sessions.
+ *
+ * The module observes outgoing messages requesting an acknowledgement and the incoming acknowledgements through the
+ * Matter tracing backend interface. Only messages acknowledged without a retransmission are sampled (Karn's
+ * algorithm), the retransmissions are reported by the reliable messaging layer. Without these reports no sample is
+ * taken and the advertised intervals are kept. The resulting retransmission timeout replaces the active
+ * retransmission interval of the peer's session parameters, which is what the reliable messaging layer uses to
+ * schedule retransmissions to that peer. A session established later with a known peer gets the current estimate
+ * when its first message is received. The bounds and table sizes are configured in chip_project_config.h.
+ */
+class AdaptiveMrp : public chip::Tracing::Backend
+#if APP_MRP_ANALYTICS_AVAILABLE
+	, public chip::Messaging::ReliableMessageAnalyticsDelegate
+#endif
+{
+public:
+	struct Counters {
+		uint32_t mTracked;
+		uint32_t mSamples;
+		uint32_t mRetransmissions;
+		uint32_t mPendingOverflows;
+		uint32_t mPeerOverflows;
+		uint32_t mUpdates;
+		uint32_t mNewSessions;
+	};
+
+	static AdaptiveMrp &Instance()
+	{
+		static AdaptiveMrp sAdaptiveMrp;
+		return sAdaptiveMrp;
+	}
+
+	CHIP_ERROR Init();
+	void Print(const struct shell *shell);
+
+	/* chip::Tracing::Backend */
+	void LogMessageSend(chip::Tracing::MessageSendInfo &info) override;
+	void LogMessageReceived(chip::Tracing::MessageReceivedInfo &info) override;
+
+#if APP_MRP_ANALYTICS_AVAILABLE
+	/* chip::Messaging::ReliableMessageAnalyticsDelegate */
+	void OnTransmitEvent(const TransmitEvent &event) override;
+#endif
+
+private:
+	struct Peer {
+		bool mInUse;
+		chip::ScopedNodeId mNodeId;
+		uint32_t mAdvertisedIdleMs;
+		uint32_t mAdvertisedActiveMs;
+		uint32_t mAppliedActiveMs;
+		uint32_t mLastUsedMs;
+		RttEstimator mEstimator;
+	};
+
+	Peer *LookupPeer(const chip::ScopedNodeId &nodeId);
+	Peer *FindPeer(const chip::ScopedNodeId &nodeId, uint32_t advertisedIdleMs, uint32_t advertisedActiveMs);
+	void Apply(Peer &peer);
+	void Configure(const Peer &peer);
+
+	RttSampler<APP_MRP_ADAPTIVE_PENDING_MESSAGES> mSampler;
+	Peer mPeers[APP_MRP_ADAPTIVE_PEERS];
+	Counters mCounters{};
+};
@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "app_storage.h"
+
+#ifdef CONFIG_APP_FLASH_MAINTENANCE
+#include "flash_maintenance.h"
+#endif
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/shell/shell.h>
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+namespace {
+
+constexpr uint8_t kAreaId = FIXED_PARTITION_ID(app_storage);
+
+#ifdef CONFIG_APP_STORAGE_BENCH
+constexpr size_t kBenchAreaSize = CONFIG_APP_STORAGE_BENCH_SECTORS * CONFIG_APP_STORAGE_SECTOR_SIZE;
+#else
+constexpr size_t kBenchAreaSize = 0;
+#endif
+
+/* The partition without the benchmark scratch area at its end, which the records never use. */
+struct flash_area RecordArea(const struct flash_area &area)
+{
+	struct flash_area recordArea = area;
+
+	recordArea.fa_size = area.fa_size > kBenchAreaSize ? area.fa_size - kBenchAreaSize : 0;
+
+	return recordArea;
+}
+
+#ifdef CONFIG_APP_FLASH_MAINTENANCE
+class CompactionJob : public FlashMaintenance::Job {
+public:
+	int Step() override
+	{
+		AppStorage &storage = AppStorage::Instance();
+		ssize_t freeSpace = storage.SectorFreeSpace();
+
+		if (freeSpace < 0) {
+			return freeSpace;
+		}
+
+		return freeSpace < CONFIG_APP_STORAGE_COMPACTION_THRESHOLD ? storage.UseNextSector() : 0;
+	}
+};
+
+CompactionJob sCompactionJob;
+#endif
+
+} /* namespace */
+
+void AppStorage::ScheduleCompaction()
+{
+#ifdef CONFIG_APP_FLASH_MAINTENANCE
+	/* Does nothing if the job is still queued. */
+	FlashMaintenance::Instance().Submit(sCompactionJob, FlashMaintenance::Priority::kLow);
+#endif
+}
+
+AppStorage &AppStorage::Instance()
+{
+#ifdef CONFIG_APP_STORAGE_BACKEND_ZMS
+	static ZmsAppStorage sAppStorage;
+#else
+	static NvsAppStorage sAppStorage;
+#endif
+	return sAppStorage;
+}
+
+int AppStorage::Init()
+{
+	const struct flash_area *area;
+	int err = flash_area_open(kAreaId, &area);
+
+	if (err) {
+		return err;
+	}
+
+	struct flash_area recordArea = RecordArea(*area);
+
+	err = Mount(&recordArea, CONFIG_APP_STORAGE_SECTOR_SIZE);
+	flash_area_close(area);
+
+	if (err) {
+		LOG_ERR("Failed to mount the %s app storage: %d", Name(), err);
+	}
+
+	return err;
+}
+
+#ifdef CONFIG_NVS
+int NvsAppStorage::Mount(const struct flash_area *area, size_t sectorSize)
+{
+	memset(&mFs, 0, sizeof(mFs));
+	mFs.flash_device = flash_area_get_device(area);
+	mFs.offset = area->fa_off;
+	mFs.sector_size = sectorSize;
+	mFs.sector_count = area->fa_size / sectorSize;
+
+	return nvs_mount(&mFs);
+}
+
+ssize_t NvsAppStorage::Read(uint32_t id, void *data, size_t size)
+{
+	return id > UINT16_MAX ? -EINVAL : nvs_read(&mFs, id, data, size);
+}
+
+ssize_t NvsAppStorage::Write(uint32_t id, const void *data, size_t size)
+{
+	return id > UINT16_MAX ? -EINVAL : nvs_write(&mFs, id, data, size);
+}
+
+int NvsAppStorage::Delete(uint32_t id)
+{
+	return id > UINT16_MAX ? -EINVAL : nvs_delete(&mFs, id);
+}
+
+ssize_t NvsAppStorage::FreeSpace()
+{
+	return nvs_calc_free_space(&mFs);
+}
+
+int NvsAppStorage::Clear()
+{
+	return nvs_clear(&mFs);
+}
+
+ssize_t NvsAppStorage::SectorFreeSpace()
+{
+	return nvs_sector_max_data_size(&mFs);
+}
+
+int NvsAppStorage::UseNextSector()
+{
+	return nvs_sector_use_next(&mFs);
+}
+#endif /* CONFIG_NVS */
+
+#ifdef CONFIG_ZMS
+int ZmsAppStorage::Mount(const struct flash_area *area, size_t sectorSize)
+{
+	memset(&mFs, 0, sizeof(mFs));
+	mFs.flash_device = flash_area_get_device(area);
+	mFs.offset = area->fa_off;
+	mFs.sector_size = sectorSize;
+	mFs.sector_count = area->fa_size / sectorSize;
+
+	return zms_mount(&mFs);
+}
+
+ssize_t ZmsAppStorage::Read(uint32_t id, void *data, size_t size)
+{
+	return zms_read(&mFs, id, data, size);
+}
+
+ssize_t ZmsAppStorage::Write(uint32_t id, const void *data, size_t size)
+{
+	return zms_write(&mFs, id, data, size);
+}
+
+int ZmsAppStorage::Delete(uint32_t id)
+{
+	return zms_delete(&mFs, id);
+}
+
+ssize_t ZmsAppStorage::FreeSpace()
+{
+	return zms_calc_free_space(&mFs);
+}
+
+int ZmsAppStorage::Clear()
+{
+	return zms_clear(&mFs);
+}
+
+ssize_t ZmsAppStorage::SectorFreeSpace()
+{
+	return zms_active_sector_free_space(&mFs);
+}
+
+int ZmsAppStorage::UseNextSector()
+{
+	return zms_sector_use_next(&mFs);
+}
+#endif /* CONFIG_ZMS */
+
+#ifdef CONFIG_SHELL
+namespace {
+
+#ifdef CONFIG_APP_STORAGE_BENCH
+constexpr size_t kBenchRecordSize = 64;
+constexpr uint32_t kBenchIds = 32;
+
+struct BenchResult {
+	uint32_t mEmptyMountUs;
+	uint32_t mFullMountUs;
+	uint32_t mWriteAvgUs;
+	uint32_t mWriteMaxUs;
+	uint32_t mPauses;
+};
+
+uint32_t ElapsedUs(uint32_t startCycles)
+{
+	return k_cyc_to_us_floor32(k_cycle_get_32() - startCycles);
+}
+
+/*
+ * Writes the given number of records rotating over a small set of identifiers, so that the storage fills up and
+ * has to reclaim space, which is where the backends differ the most.
+ */
+int Bench(AppStorage &storage, const struct flash_area *area, uint32_t records, BenchResult &result)
+{
+	uint8_t record[kBenchRecordSize];
+	uint64_t totalUs = 0;
+	uint32_t start;
+	int err;
+
+	memset(&result, 0, sizeof(result));
+
+	err = storage.Mount(area, CONFIG_APP_STORAGE_SECTOR_SIZE);
+	if (!err) {
+		err = storage.Clear();
+	}
+	if (err) {
+		return err;
+	}
+
+	start = k_cycle_get_32();
+	err = storage.Mount(area, CONFIG_APP_STORAGE_SECTOR_SIZE);
+	result.mEmptyMountUs = ElapsedUs(start);
+	if (err) {
+		return err;
+	}
+
+	for (uint32_t i = 0; i < records; i++) {
+		uint32_t durationUs;
+		ssize_t written;
+
+		memset(record, static_cast<uint8_t>(i), sizeof(record));
+		start = k_cycle_get_32();
+		written = storage.Write(i % kBenchIds, record, sizeof(record));
+		durationUs = ElapsedUs(start);
+
+		if (written < 0) {
+			return written;
+		}
+
+		totalUs += durationUs;
+		result.mWriteMaxUs = MAX(result.mWriteMaxUs, durationUs);
+		if (durationUs >= CONFIG_APP_STORAGE_BENCH_PAUSE_THRESHOLD_US) {
+			result.mPauses++;
+		}
+	}
+
+	result.mWriteAvgUs = records ? static_cast<uint32_t>(totalUs / records) : 0;
+
+	start = k_cycle_get_32();
+	err = storage.Mount(area, CONFIG_APP_STORAGE_SECTOR_SIZE);
+	result.mFullMountUs = ElapsedUs(start);
+	if (err) {
+		return err;
+	}
+
+	return storage.Clear();
+}
+
+int StorageBenchHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	uint32_t records = argc > 1 ? strtoul(argv[1], nullptr, 10) : 2000;
+	const struct flash_area *area;
+	struct flash_area benchArea;
+	BenchResult result;
+	int err;
+
+#ifdef CONFIG_NVS
+	static NvsAppStorage sNvs;
+#endif
+#ifdef CONFIG_ZMS
+	static ZmsAppStorage sZms;
+#endif
+	AppStorage *backends[] = {
+#ifdef CONFIG_NVS
+		&sNvs,
+#endif
+#ifdef CONFIG_ZMS
+		&sZms,
+#endif
+	};
+
+	err = flash_area_open(kAreaId, &area);
+	if (err) {
+		shell_error(shell, "Cannot open the app storage partition: %d", err);
+		return err;
+	}
+
+	/* Only the scratch area is erased, the application records stay in place and can be written meanwhile. */
+	benchArea = *area;
+	benchArea.fa_off += RecordArea(*area).fa_size;
+	benchArea.fa_size = MIN(area->fa_size, kBenchAreaSize);
+	flash_area_close(area);
+
+	shell_print(shell, "%u records of %u B over %u ids, scratch area %u KiB, sector %u B", records,
+		    static_cast<unsigned>(kBenchRecordSize), kBenchIds, static_cast<unsigned>(benchArea.fa_size / 1024),
+		    CONFIG_APP_STORAGE_SECTOR_SIZE);
+	shell_print(shell, "%-8s %-14s %-13s %-12s %-12s %-7s", "backend", "mount_empty_us", "mount_full_us",
+		    "write_avg_us", "write_max_us", "pauses");
+
+	for (AppStorage *backend : backends) {
+		err = Bench(*backend, &benchArea, records, result);
+		if (err) {
+			shell_error(shell, "%s: failed: %d", backend->Name(), err);
+			continue;
+		}
+
+		shell_print(shell, "%-8s %-14u %-13u %-12u %-12u %-7u", backend->Name(), result.mEmptyMountUs,
+			    result.mFullMountUs, result.mWriteAvgUs, result.mWriteMaxUs, result.mPauses);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_APP_STORAGE_BENCH */
+
+int StorageInfoHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	shell_print(shell, "backend: %s, free: %d B", AppStorage::Instance().Name(),
+		    static_cast<int>(AppStorage::Instance().FreeSpace()));
+	return 0;
+}
+
+} /* namespace */
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_app_storage,
+			       SHELL_CMD_ARG(info, NULL, "Print the app storage backend and free space",
+					     StorageInfoHandler, 1, 0),
+#ifdef CONFIG_APP_STORAGE_BENCH
+			       SHELL_CMD_ARG(bench, NULL,
+					     "Compare the available backends on the scratch area of the app storage "
+					     "partition. Usage: bench [records]",
+					     StorageBenchHandler, 1, 1),
+#endif
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((app), storage, &sub_app_storage, "Application data storage", NULL, 1, 0);
+#endif /* CONFIG_SHELL */
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <zephyr/storage/flash_map.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#ifdef CONFIG_NVS
+#include <zephyr/fs/nvs.h>
+#endif
+#ifdef CONFIG_ZMS
+#include <zephyr/fs/zms.h>
+#endif
+
+/*
+ * Record storage for the application data kept outside of the settings, on the app_storage partition. Records are
+ * addressed by numeric identifiers, which maps directly onto both NVS and ZMS. The backend is selected with the
+ * APP_STORAGE_BACKEND choice: ZMS on boards with RRAM, where it avoids the erase cycles NVS is designed around,
+ * and NVS on boards storing the data in NOR flash. With CONFIG_APP_STORAGE_BENCH, the "app storage bench" shell
+ * command compares both backends on a scratch area at the end of the partition.
+ */
+class AppStorage {
+public:
+	/* Returns the backend selected in Kconfig. */
+	static AppStorage &Instance();
+
+	virtual ~AppStorage() = default;
+
+	/* Mounts the storage on the app_storage partition. */
+	int Init();
+	/*
+	 * Moves to the next sector when the current one is almost full, so the space is reclaimed by the flash
+	 * maintenance thread ahead of time instead of by the next write. Writers call it after writing.
+	 */
+	void ScheduleCompaction();
+
+	virtual const char *Name() const = 0;
+	virtual int Mount(const struct flash_area *area, size_t sectorSize) = 0;
+	virtual ssize_t Read(uint32_t id, void *data, size_t size) = 0;
+	virtual ssize_t Write(uint32_t id, const void *data, size_t size) = 0;
+	virtual int Delete(uint32_t id) = 0;
+	virtual ssize_t FreeSpace() = 0;
+	/* Erases all records. The storage must be mounted again afterwards. */
+	virtual int Clear() = 0;
+	/* Space left in the sector being written and closing it, which reclaims the oldest sector. */
+	virtual ssize_t SectorFreeSpace() = 0;
+	virtual int UseNextSector() = 0;
+};
+
+#ifdef CONFIG_NVS
+class NvsAppStorage : public AppStorage {
+public:
+	const char *Name() const override { return "nvs"; }
+	int Mount(const struct flash_area *area, size_t sectorSize) override;
+	ssize_t Read(uint32_t id, void *data, size_t size) override;
+	ssize_t Write(uint32_t id, const void *data, size_t size) override;
+	int Delete(uint32_t id) override;
+	ssize_t FreeSpace() override;
+	int Clear() override;
+	ssize_t SectorFreeSpace() override;
+	int UseNextSector() override;
+
+private:
+	struct nvs_fs mFs {};
+};
+#endif
+
+#ifdef CONFIG_ZMS
+class ZmsAppStorage : public AppStorage {
+public:
+	const char *Name() const override { return "zms"; }
+	int Mount(const struct flash_area *area, size_t sectorSize) override;
+	ssize_t Read(uint32_t id, void *data, size_t size) override;
+	ssize_t Write(uint32_t id, const void *data, size_t size) override;
+	int Delete(uint32_t id) override;
+	ssize_t FreeSpace() override;
+	int Clear() override;
+	ssize_t SectorFreeSpace() override;
+	int UseNextSector() override;
+
+private:
+	struct zms_fs mFs {};
+};
+#endif
@@ -5,6 +5,74 @@
  */
 
 #include "app_task.h"
+#include "sensor_config.h"
+
+#ifdef CONFIG_APP_REPORT_STATS
+#include "report_stats.h"
+#endif
+#ifdef CONFIG_APP_MEASUREMENT_PUBLISH
+#include "measurement_publisher.h"
+#endif
+#ifdef CONFIG_APP_MRP_ADAPTIVE
+#include "adaptive_mrp.h"
+#endif
+#ifdef CONFIG_APP_POLL_CONTROLLER
+#include "poll_controller.h"
+#endif
+#ifdef CONFIG_APP_CSL_SCHEDULER
+#include "csl_scheduler.h"
+#endif
+#ifdef CONFIG_APP_WIFI_POWER
+#include "wifi_power.h"
+#endif
+#ifdef CONFIG_APP_OTA_WRITER
+#include "ota_requestor.h"
+#endif
+#ifdef CONFIG_APP_SETTINGS_STATS
+#include "settings_stats.h"
+#endif
+#ifdef CONFIG_APP_SERVER_INIT_PARAMS
+#include "server_init_params.h"
+#endif
+#ifdef CONFIG_APP_SETTINGS_COALESCE
+#include "settings_coalesce.h"
+#endif
+#ifdef CONFIG_APP_FLASH_MAINTENANCE
+#include "flash_maintenance.h"
+#endif
+#ifdef CONFIG_APP_STORAGE
+#include "app_storage.h"
+#endif
+#ifdef CONFIG_APP_HISTORY
+#include "history_log.h"
+#endif
+#ifdef CONFIG_APP_HISTORY_SMP
+#include "history_smp.h"
+#endif
+#ifdef CONFIG_APP_BT_ESS
+#include "bt_ess.h"
+#endif
+#ifdef CONFIG_APP_TIME_SYNC
+#include "time_sync.h"
+#endif
+#ifdef CONFIG_APP_CASE_RESUMPTION
+#include "session_resumption.h"
+#endif
+#ifdef CONFIG_APP_POOL_STATS
+#include "pool_stats.h"
+#endif
+#ifdef CONFIG_APP_CPU_LOAD
+#include "cpu_load.h"
+#endif
+#ifdef CONFIG_APP_IM_STATS
+#include "im_stats.h"
+#endif
+#ifdef CONFIG_APP_RADIO_STATS
+#include "radio_stats.h"
+#endif
+#ifdef CONFIG_APP_LOAD_SCENARIOS
+#include "load_scenarios.h"
+#endif
 
 #include "app/matter_init.h"
 #include "app/task_executor.h"
@@ -26,14 +94,15 @@
 #include <zephyr/device.h>
 #include <zephyr/drivers/sensor.h>
 
+#include <stdlib.h>
+
 #define CONFIG_USE_VIRTUAL_SENSOR_DATA 
 //#define CONFIG_USE_REAL_SENSOR_DATA
 #if defined(CONFIG_USE_VIRTUAL_SENSOR_DATA) && defined(CONFIG_USE_REAL_SENSOR_DATA)
   #error "Only one of CONFIG_USE_VIRTUAL_SENSOR_DATA or CONFIG_USE_REAL_SENSOR_DATA must be defined"
 #endif
 
-// 온습도 업데이트 주기 (10초)
-#define SENSOR_UPDATE_PERIOD_MS 10000
+// 온습도 업데이트 주기, 데드밴드, 필터는 SensorConfig에서 설정 (기본 10초)
 // 온습도 업데이트 스레드
 K_THREAD_STACK_DEFINE(sensor_stack, 2048);
 
@@ -126,36 +195,104 @@ void GetSensorData(float *temperatureC, float *humidityRH)
 }
 
 // 온습도 값을 Matter 속성에 업데이트하는 함수
-void UpdateTemperatureHumidity(float temperatureC, float humidityRH)
+// 필터 상태와 마지막으로 반영한 값 (데드밴드 비교용)
+static MeasurementFilter sTemperatureFilter;
+static MeasurementFilter sHumidityFilter;
+static bool sMeasured = false;
+static int16_t sLastTempValue;
+static uint16_t sLastHumValue;
+#ifdef CONFIG_APP_HISTORY
+static uint8_t sHistorySamples;
+#endif
+
+// MeasuredValue 속성 중 하나라도 바뀌었으면 true 반환 (리포트 예정)
+bool UpdateTemperatureHumidity(float temperatureC, float humidityRH)
 {
     using namespace chip::app::Clusters;
     using chip::Protocols::InteractionModel::Status;
 
+    SensorConfig::Config config = SensorConfig::Instance().Get();
+
+    // 1) 설정된 필터 적용
+    temperatureC = sTemperatureFilter.Apply(config.mFilterType, temperatureC);
+    humidityRH   = sHumidityFilter.Apply(config.mFilterType, humidityRH);
+
     // 2) Matter 단위로 변환 (0.01 단위)
     // Temperature: 0.01°C 단위
     int16_t tempValue = static_cast<int16_t>(temperatureC * 100);
     // Humidity: 0.01% 단위  
     uint16_t humValue = static_cast<uint16_t>(humidityRH * 100);
 
+    // 데드밴드 이상 변한 값만 속성에 반영 (리포트 횟수 감소)
+    bool updateTemp = !sMeasured || abs(tempValue - sLastTempValue) >= config.mTemperatureDeadband;
+    bool updateHum  = !sMeasured || abs(humValue - sLastHumValue) >= config.mHumidityDeadband;
+
+    sMeasured = true;
+
     // 3) Temperature 속성 업데이트
-    Status statusTemp = TemperatureMeasurement::Attributes::MeasuredValue::Set(kEndpointId, tempValue);
-    
-    if (statusTemp != Status::Success) {
-        LOG_ERR("Failed to update temperature: 0x%02X", static_cast<uint8_t>(statusTemp));
-    } else {
-        LOG_DBG("Temperature updated: %d (%.2f°C)", tempValue, (double)(temperatureC));
+    if (updateTemp) {
+        Status statusTemp = TemperatureMeasurement::Attributes::MeasuredValue::Set(kEndpointId, tempValue);
+
+        if (statusTemp != Status::Success) {
+            LOG_ERR("Failed to update temperature: 0x%02X", static_cast<uint8_t>(statusTemp));
+        } else {
+            LOG_DBG("Temperature updated: %d (%.2f°C)", tempValue, (double)(temperatureC));
+        }
+        sLastTempValue = tempValue;
     }
 
     // 4) Humidity 속성 업데이트 (ZAP 파일에 클러스터 추가 필요)
     // 주의: RelativeHumidityMeasurement 클러스터가 ZAP 파일에 추가되어야 함
-    Status statusHum = RelativeHumidityMeasurement::Attributes::MeasuredValue::Set(kEndpointId, humValue);
-    
-    if (statusHum != Status::Success) {
-        LOG_ERR("Failed to update humidity: 0x%02X", static_cast<uint8_t>(statusHum));
-    } else {
-        LOG_DBG("Humidity updated: %d (%.2f%%)", humValue, (double)(humidityRH));
+    if (updateHum) {
+        Status statusHum = RelativeHumidityMeasurement::Attributes::MeasuredValue::Set(kEndpointId, humValue);
+
+        if (statusHum != Status::Success) {
+            LOG_ERR("Failed to update humidity: 0x%02X", static_cast<uint8_t>(statusHum));
+        } else {
+            LOG_DBG("Humidity updated: %d (%.2f%%)", humValue, (double)(humidityRH));
+        }
+        sLastHumValue = humValue;
+    }
+
+#ifdef CONFIG_APP_MEASUREMENT_PUBLISH
+    // 5) Binding 대상(그룹/유니캐스트)으로 측정값 전송
+    if (updateTemp || updateHum) {
+        MeasurementPublisher::Instance().Publish(sLastTempValue, sLastHumValue);
+    }
+#endif
+
+#ifdef CONFIG_APP_HISTORY
+    // 6) 히스토리 로그에 측정값 기록 (설정된 비율로 솎아냄)
+    if (++sHistorySamples >= config.mHistoryDecimation) {
+        sHistorySamples = 0;
+        HistoryLog::Instance().Append(tempValue, humValue);
+    }
+#endif
+
+#ifdef CONFIG_APP_BT_ESS
+    // 7) BLE Environmental Sensing Service 값 갱신 및 알림
+    BtEss::Instance().Update(tempValue, humValue);
+#endif
+
+    return updateTemp || updateHum;
+}
+
+#ifdef CONFIG_APP_LOAD_SCENARIOS
+// 센서 오류 시 측정값을 null로 설정 (Matter 규격상 측정 불가 상태)
+void InvalidateTemperatureHumidity()
+{
+    using namespace chip::app::Clusters;
+    using chip::Protocols::InteractionModel::Status;
+
+    if (TemperatureMeasurement::Attributes::MeasuredValue::SetNull(kEndpointId) != Status::Success ||
+        RelativeHumidityMeasurement::Attributes::MeasuredValue::SetNull(kEndpointId) != Status::Success) {
+        LOG_ERR("Failed to invalidate the measurements");
     }
+
+    // 복구 후 첫 샘플은 데드밴드와 무관하게 반영
+    sMeasured = false;
 }
+#endif
 
 // 센서 업데이트 스레드 함수
 void sensor_thread_func(void *arg1, void *arg2, void *arg3)
@@ -173,9 +310,45 @@ void sensor_thread_func(void *arg1, void *arg2, void *arg3)
     k_sleep(K_SECONDS(5));
 
     while (1) {
+        uint32_t periodMs = SensorConfig::Instance().Get().mSamplePeriodMs;
+
+#ifdef CONFIG_APP_BT_ESS
+        // ESS 클라이언트가 알림을 구독 중이면 짧은 주기로 샘플링
+        if (BtEss::Instance().IsSubscribed()) {
+            periodMs = CONFIG_APP_BT_ESS_SAMPLE_PERIOD_MS;
+        }
+#endif
+
         GetSensorData( &temperatureC, &humidityRH);
-        UpdateTemperatureHumidity(temperatureC, humidityRH);
-        k_sleep(K_MSEC(SENSOR_UPDATE_PERIOD_MS));
+        bool changed;
+#ifdef CONFIG_APP_LOAD_SCENARIOS
+        // 부하 시나리오 실행 중에는 시나리오가 샘플 주기와 측정값을 조작
+        LoadScenarios::Sample sample = LoadScenarios::Instance().OnSample(temperatureC, humidityRH, periodMs);
+
+        if (sample.mValid) {
+            changed = UpdateTemperatureHumidity(sample.mTemperatureC, sample.mHumidityRH);
+        } else {
+            InvalidateTemperatureHumidity();
+            changed = true;
+        }
+#else
+        changed = UpdateTemperatureHumidity(temperatureC, humidityRH);
+#endif
+#ifdef CONFIG_APP_POLL_CONTROLLER
+        // 값이 바뀌어 리포트가 예정된 경우에만 빠른 폴링 창을 엶
+        PollController::Instance().OnSample(periodMs, changed);
+#else
+        ARG_UNUSED(changed);
+#endif
+#ifdef CONFIG_APP_WIFI_POWER
+        WifiPower::Instance().OnSample(periodMs);
+#endif
+#ifdef CONFIG_APP_CSL_SCHEDULER
+        // 다음 샘플을 가장 가까운 CSL 수신 윈도우에 맞춤
+        k_sleep(K_USEC(CslScheduler::Instance().OnSample(periodMs)));
+#else
+        k_sleep(K_MSEC(periodMs));
+#endif
     }
 }
 
@@ -216,16 +389,108 @@ static bool sensor_device_init( void )
 }
 #endif
 
+static CHIP_ERROR PostServerInit()
+{
+#ifdef CONFIG_APP_SETTINGS_COALESCE
+	CoalescingStorageDelegate::Instance().InstallShutdownHook();
+#endif
+#ifdef CONFIG_APP_REPORT_STATS
+	ReturnErrorOnFailure(ReportStats::Instance().Init());
+#endif
+#ifdef CONFIG_APP_MEASUREMENT_PUBLISH
+	ReturnErrorOnFailure(MeasurementPublisher::Instance().Init());
+#endif
+#ifdef CONFIG_APP_MRP_ADAPTIVE
+	ReturnErrorOnFailure(AdaptiveMrp::Instance().Init());
+#endif
+#ifdef CONFIG_APP_POLL_CONTROLLER
+	ReturnErrorOnFailure(PollController::Instance().Init());
+#endif
+#ifdef CONFIG_APP_CSL_SCHEDULER
+	ReturnErrorOnFailure(CslScheduler::Instance().Init(SensorConfig::Instance().Get().mSamplePeriodMs));
+#endif
+#ifdef CONFIG_APP_WIFI_POWER
+	ReturnErrorOnFailure(WifiPower::Instance().Init(SensorConfig::Instance().Get().mSamplePeriodMs));
+#endif
+#ifdef CONFIG_APP_OTA_WRITER
+	ReturnErrorOnFailure(OtaRequestor::Instance().Init());
+#endif
+#ifdef CONFIG_APP_FLASH_MAINTENANCE
+	if (FlashMaintenance::Instance().Init() != 0) {
+		return CHIP_ERROR_INTERNAL;
+	}
+#endif
+#ifdef CONFIG_APP_STORAGE
+	if (AppStorage::Instance().Init() != 0) {
+		return CHIP_ERROR_PERSISTED_STORAGE_FAILED;
+	}
+#endif
+#ifdef CONFIG_APP_HISTORY
+	if (HistoryLog::Instance().Init() != 0) {
+		return CHIP_ERROR_PERSISTED_STORAGE_FAILED;
+	}
+#endif
+#ifdef CONFIG_APP_HISTORY_SMP
+	HistorySmp::Instance().Init();
+#endif
+#ifdef CONFIG_APP_BT_ESS
+	ReturnErrorOnFailure(BtEss::Instance().Init());
+#endif
+#ifdef CONFIG_APP_TIME_SYNC
+	ReturnErrorOnFailure(TimeSync::Instance().Init());
+#endif
+#ifdef CONFIG_APP_CASE_RESUMPTION
+	ReturnErrorOnFailure(SessionResumptionCache::Instance().Start());
+#endif
+#ifdef CONFIG_APP_POOL_STATS
+	ReturnErrorOnFailure(PoolStats::Instance().Init());
+#endif
+#ifdef CONFIG_APP_CPU_LOAD
+	CpuLoad::Instance().Init();
+#endif
+#ifdef CONFIG_APP_IM_STATS
+	ReturnErrorOnFailure(ImStats::Instance().Init());
+#endif
+#ifdef CONFIG_APP_RADIO_STATS
+	ReturnErrorOnFailure(RadioStats::Instance().Init());
+#endif
+#ifdef CONFIG_APP_LOAD_SCENARIOS
+	ReturnErrorOnFailure(LoadScenarios::Instance().Init(&sensor_thread_data));
+#endif
+	return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR AppTask::Init()
 {
+	Nrf::Matter::InitData initData;
+
+#ifdef CONFIG_APP_SERVER_INIT_PARAMS
+	static AppServerInitParams sServerInitParams;
+	initData.mServerInitParams = &sServerInitParams;
+#endif
+	initData.mPostServerInitClbk = PostServerInit;
+
+#ifdef CONFIG_APP_SETTINGS_STATS
+	/* Must be installed before the Matter stack starts using the settings. */
+	ReturnErrorOnFailure(SettingsStats::Instance().Init());
+#endif
+
+#ifdef CONFIG_APP_OTA_WRITER
+	/* Must be installed before the Matter server, so that the common code does not create a second requestor. */
+	OtaRequestor::Instance().Install();
+#endif
+
 	/* Initialize Matter stack */
-	ReturnErrorOnFailure(Nrf::Matter::PrepareServer());
+	ReturnErrorOnFailure(Nrf::Matter::PrepareServer(initData));
 
 	if (!Nrf::GetBoard().Init()) {
 		LOG_ERR("User interface initialization failed.");
 		return CHIP_ERROR_INCORRECT_STATE;
 	}
 
+	/* Load the sampling and reporting configuration stored in the settings. */
+	SensorConfig::Instance().Init(&sensor_thread_data);
+
   /* Initialize sensor */
   #if defined(CONFIG_USE_REAL_SENSOR_DATA)
   sensor_device_init();
@@ -238,6 +503,7 @@ CHIP_ERROR AppTask::Init()
                    NULL, NULL, NULL,
                    K_PRIO_COOP(5),
                    0, K_NO_WAIT);
+  k_thread_name_set(&sensor_thread_data, "sensor");
 
 	/* Register Matter event handler that controls the connectivity status LED based on the captured Matter network
 	 * state. */
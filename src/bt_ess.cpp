@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "bt_ess.h"
+
+#include <platform/CHIPDeviceLayer.h>
+
+#include <zephyr/bluetooth/gatt.h>
+#include <zephyr/bluetooth/uuid.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/byteorder.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+using namespace ::chip::DeviceLayer;
+
+namespace {
+
+const uint8_t kAdvertisingFlags = BT_LE_AD_GENERAL | BT_LE_AD_NO_BREDR;
+const uint8_t kEssUuid[] = { BT_UUID_16_ENCODE(BT_UUID_ESS_VAL) };
+
+bt_data sAdvertisingItems[] = {
+	BT_DATA(BT_DATA_FLAGS, &kAdvertisingFlags, sizeof(kAdvertisingFlags)),
+	BT_DATA(BT_DATA_UUID16_ALL, kEssUuid, sizeof(kEssUuid)),
+};
+
+bt_data sScanResponseItems[] = {
+	BT_DATA(BT_DATA_NAME_COMPLETE, CONFIG_BT_DEVICE_NAME, sizeof(CONFIG_BT_DEVICE_NAME) - 1),
+};
+
+_bt_gatt_ccc sTemperatureCcc = BT_GATT_CCC_INITIALIZER(BtEss::TemperatureCccChanged, nullptr, nullptr);
+_bt_gatt_ccc sHumidityCcc = BT_GATT_CCC_INITIALIZER(BtEss::HumidityCccChanged, nullptr, nullptr);
+
+struct bt_gatt_attr sEssAttributes[] = {
+	BT_GATT_PRIMARY_SERVICE(BT_UUID_ESS),
+	BT_GATT_CHARACTERISTIC(BT_UUID_TEMPERATURE, BT_GATT_CHRC_READ | BT_GATT_CHRC_NOTIFY, BT_GATT_PERM_READ,
+			       BtEss::ReadTemperature, nullptr, nullptr),
+	BT_GATT_CCC_MANAGED(&sTemperatureCcc, BT_GATT_PERM_READ | BT_GATT_PERM_WRITE),
+	BT_GATT_CHARACTERISTIC(BT_UUID_HUMIDITY, BT_GATT_CHRC_READ | BT_GATT_CHRC_NOTIFY, BT_GATT_PERM_READ,
+			       BtEss::ReadHumidity, nullptr, nullptr),
+	BT_GATT_CCC_MANAGED(&sHumidityCcc, BT_GATT_PERM_READ | BT_GATT_PERM_WRITE),
+};
+
+/* Value attributes of the characteristics, following their declarations. */
+const struct bt_gatt_attr *const kTemperatureAttribute = &sEssAttributes[2];
+const struct bt_gatt_attr *const kHumidityAttribute = &sEssAttributes[5];
+
+struct bt_gatt_service sEssService = BT_GATT_SERVICE(sEssAttributes);
+
+} /* namespace */
+
+CHIP_ERROR BtEss::Init()
+{
+	int err = bt_gatt_service_register(&sEssService);
+
+	if (err) {
+		LOG_ERR("Failed to register the Environmental Sensing Service: %d", err);
+		return System::MapErrorZephyr(err);
+	}
+
+	mConnCallbacks.connected = Connected;
+	mConnCallbacks.disconnected = Disconnected;
+	mConnCallbacks.le_param_updated = ParamUpdated;
+	bt_conn_cb_register(&mConnCallbacks);
+
+	mAdvertisingRequest.priority = CONFIG_APP_BT_ESS_ADV_PRIORITY;
+	mAdvertisingRequest.options = BT_LE_ADV_OPT_CONN;
+	mAdvertisingRequest.minInterval = CONFIG_APP_BT_ESS_ADV_INTERVAL_MIN;
+	mAdvertisingRequest.maxInterval = CONFIG_APP_BT_ESS_ADV_INTERVAL_MAX;
+	mAdvertisingRequest.advertisingData = Span<bt_data>(sAdvertisingItems);
+	mAdvertisingRequest.scanResponseData = Span<bt_data>(sScanResponseItems);
+	mAdvertisingRequest.onStarted = [](int result) {
+		if (result) {
+			LOG_ERR("Failed to start the Environmental Sensing Service advertising: %d", result);
+		}
+		BtEss::Instance().OnAdvertising(result == 0);
+	};
+	mAdvertisingRequest.onStopped = []() { BtEss::Instance().OnAdvertising(false); };
+
+	StartAdvertising();
+
+	return CHIP_NO_ERROR;
+}
+
+bool BtEss::IsSubscribed() const
+{
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+	bool subscribed = mState.IsSubscribed();
+
+	k_spin_unlock(&mLock, key);
+
+	return subscribed;
+}
+
+struct bt_conn *BtEss::RefConnection() const
+{
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+	struct bt_conn *conn = mState.GetConnection();
+
+	/* The reference keeps the connection object valid if the client disconnects in the meantime. */
+	if (conn != nullptr) {
+		bt_conn_ref(conn);
+	}
+
+	k_spin_unlock(&mLock, key);
+
+	return conn;
+}
+
+void BtEss::OnAdvertising(bool advertising)
+{
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+
+	mState.OnAdvertising(advertising);
+	k_spin_unlock(&mLock, key);
+}
+
+void BtEss::StartAdvertising()
+{
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+	bool connected = mState.GetConnection() != nullptr;
+
+	k_spin_unlock(&mLock, key);
+
+	/* Inserting the request again restarts the advertising if no request of a higher priority is pending. */
+	if (!connected) {
+		BLEAdvertisingArbiter::InsertRequest(mAdvertisingRequest);
+	}
+}
+
+void BtEss::StopAdvertising()
+{
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+	bool connected = mState.GetConnection() != nullptr;
+
+	k_spin_unlock(&mLock, key);
+
+	/* Cancelling a request which is not in the arbiter queue is a no-op. */
+	if (connected) {
+		BLEAdvertisingArbiter::CancelRequest(mAdvertisingRequest);
+	}
+}
+
+void BtEss::Connected(struct bt_conn *conn, uint8_t err)
+{
+	BtEss &ess = Instance();
+	struct bt_conn_info info;
+	const struct bt_le_conn_param param = BT_LE_CONN_PARAM_INIT(
+		CONFIG_APP_BT_ESS_CONN_INTERVAL_MIN, CONFIG_APP_BT_ESS_CONN_INTERVAL_MAX, CONFIG_APP_BT_ESS_CONN_LATENCY,
+		CONFIG_APP_BT_ESS_CONN_TIMEOUT);
+
+	if (err || bt_conn_get_info(conn, &info) != 0) {
+		return;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&ess.mLock);
+
+	/* Only a connection made while the service was the one advertising belongs to it. */
+	if (!ess.mState.OnConnected(conn, info.role == BT_CONN_ROLE_PERIPHERAL)) {
+		k_spin_unlock(&ess.mLock, key);
+		return;
+	}
+
+	/* Taken before the connection is visible to other threads, released in Disconnected(). */
+	bt_conn_ref(conn);
+	ess.mInterval = info.le.interval;
+	k_spin_unlock(&ess.mLock, key);
+
+	/* The arbiter is only used on the Matter thread. */
+	PlatformMgr().ScheduleWork([](intptr_t) { BtEss::Instance().StopAdvertising(); });
+
+	err = bt_conn_le_param_update(conn, &param);
+	if (err) {
+		LOG_WRN("Failed to request the Environmental Sensing Service connection parameters: %d", err);
+	}
+}
+
+void BtEss::Disconnected(struct bt_conn *conn, uint8_t reason)
+{
+	BtEss &ess = Instance();
+	k_spinlock_key_t key = k_spin_lock(&ess.mLock);
+	bool owned = ess.mState.OnDisconnected(conn);
+
+	k_spin_unlock(&ess.mLock, key);
+
+	if (!owned) {
+		return;
+	}
+
+	/* A notification in progress holds its own reference. */
+	bt_conn_unref(conn);
+
+	PlatformMgr().ScheduleWork([](intptr_t) { BtEss::Instance().StartAdvertising(); });
+}
+
+void BtEss::ParamUpdated(struct bt_conn *conn, uint16_t interval, uint16_t latency, uint16_t timeout)
+{
+	BtEss &ess = Instance();
+	k_spinlock_key_t key = k_spin_lock(&ess.mLock);
+
+	if (conn == ess.mState.GetConnection()) {
+		ess.mInterval = interval;
+	}
+
+	k_spin_unlock(&ess.mLock, key);
+}
+
+ssize_t BtEss::ReadTemperature(struct bt_conn *conn, const struct bt_gatt_attr *attr, void *buf, uint16_t len,
+			       uint16_t offset)
+{
+	BtEss &ess = Instance();
+	k_spinlock_key_t key = k_spin_lock(&ess.mLock);
+	int16_t value = sys_cpu_to_le16(ess.mTemperature);
+
+	k_spin_unlock(&ess.mLock, key);
+
+	return bt_gatt_attr_read(conn, attr, buf, len, offset, &value, sizeof(value));
+}
+
+ssize_t BtEss::ReadHumidity(struct bt_conn *conn, const struct bt_gatt_attr *attr, void *buf, uint16_t len,
+			    uint16_t offset)
+{
+	BtEss &ess = Instance();
+	k_spinlock_key_t key = k_spin_lock(&ess.mLock);
+	uint16_t value = sys_cpu_to_le16(ess.mHumidity);
+
+	k_spin_unlock(&ess.mLock, key);
+
+	return bt_gatt_attr_read(conn, attr, buf, len, offset, &value, sizeof(value));
+}
+
+void BtEss::OnCccChanged(State::Characteristic characteristic, const struct bt_gatt_attr *attr)
+{
+	struct bt_conn *conn = RefConnection();
+	/* The value passed to the callback is shared by all connections, check the one of the service. */
+	bool notify = conn != nullptr && bt_gatt_is_subscribed(conn, attr, BT_GATT_CCC_NOTIFY);
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+
+	/* The client may have disconnected meanwhile, which cleared the state already. */
+	if (conn != nullptr && conn == mState.GetConnection()) {
+		mState.OnCccChanged(characteristic, notify);
+	}
+
+	k_spin_unlock(&mLock, key);
+
+	if (conn != nullptr) {
+		bt_conn_unref(conn);
+	}
+}
+
+void BtEss::TemperatureCccChanged(const struct bt_gatt_attr *attr, uint16_t value)
+{
+	Instance().OnCccChanged(State::kTemperature, kTemperatureAttribute);
+}
+
+void BtEss::HumidityCccChanged(const struct bt_gatt_attr *attr, uint16_t value)
+{
+	Instance().OnCccChanged(State::kHumidity, kHumidityAttribute);
+}
+
+void BtEss::Update(int16_t temperature, uint16_t humidity)
+{
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+	struct bt_conn *conn = mState.GetConnection();
+	bool notifyTemperature = mState.ShouldNotify(State::kTemperature);
+	bool notifyHumidity = mState.ShouldNotify(State::kHumidity);
+	uint32_t notifications = 0;
+
+	mTemperature = temperature;
+	mHumidity = humidity;
+
+	if (conn != nullptr) {
+		bt_conn_ref(conn);
+	}
+
+	k_spin_unlock(&mLock, key);
+
+	if (conn == nullptr) {
+		return;
+	}
+
+	/*
+	 * Notifications go to the client of the service only, not to other connections that may have subscribed. They
+	 * may block for a buffer, so the lock is not held. A notification on a connection being torn down fails.
+	 */
+	if (notifyTemperature) {
+		int16_t value = sys_cpu_to_le16(temperature);
+
+		notifications += bt_gatt_notify(conn, kTemperatureAttribute, &value, sizeof(value)) == 0;
+	}
+
+	if (notifyHumidity) {
+		uint16_t value = sys_cpu_to_le16(humidity);
+
+		notifications += bt_gatt_notify(conn, kHumidityAttribute, &value, sizeof(value)) == 0;
+	}
+
+	bt_conn_unref(conn);
+
+	key = k_spin_lock(&mLock);
+	mNotifications += notifications;
+	k_spin_unlock(&mLock, key);
+}
+
+#ifdef CONFIG_SHELL
+void BtEss::Print(const struct shell *shell)
+{
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+	State state = mState;
+	uint16_t interval = mInterval;
+	uint32_t notifications = mNotifications;
+
+	k_spin_unlock(&mLock, key);
+
+	shell_print(shell, "advertising: %s, connected: %s, subscribed: %s", state.IsAdvertising() ? "yes" : "no",
+		    state.GetConnection() ? "yes" : "no", state.IsSubscribed() ? "yes" : "no");
+	if (state.GetConnection()) {
+		shell_print(shell, "connection interval: %u us", BT_CONN_INTERVAL_TO_US(interval));
+	}
+	shell_print(shell, "connections: %u, notifications: %u", state.GetConnections(), notifications);
+}
+
+static int EssShowHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	BtEss::Instance().Print(shell);
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_ess,
+			       SHELL_CMD_ARG(show, NULL, "Print the Environmental Sensing Service state", EssShowHandler,
+					     1, 0),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((app), ess, &sub_ess, "Bluetooth LE Environmental Sensing Service", NULL, 1, 0);
+#endif /* CONFIG_SHELL */
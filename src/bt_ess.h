@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include "bt_ess_state.h"
+
+#include <lib/core/CHIPError.h>
+#include <platform/Zephyr/BLEAdvertisingArbiter.h>
+
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/spinlock.h>
+
+struct shell;
+
+/*
+ * Bluetooth LE Environmental Sensing Service exposing the measured values to a phone without commissioning the
+ * device. The Temperature and Humidity characteristics use the units of the MeasuredValue attributes, so the values
+ * are passed through unchanged, and are notified on every sample.
+ *
+ * The service advertises through the Matter advertising arbiter with a lower priority than Matter, so it only
+ * advertises when the commissioning advertising is not running. Its request is cancelled while a client is connected,
+ * so that the arbiter does not restart the advertising when a request of a higher priority ends. A client connection
+ * requests the connection parameters configured by the CONFIG_APP_BT_ESS_CONN_* Kconfig options, which bounds the
+ * radio time it takes from Thread or Wi-Fi, and makes the sensor thread sample every
+ * CONFIG_APP_BT_ESS_SAMPLE_PERIOD_MS while a client is subscribed.
+ *
+ * The state is changed by the Bluetooth RX thread and the Matter thread and read by the sensor thread, so it is
+ * guarded by a spinlock. The connection is referenced for the duration of a notification, which is sent without
+ * holding the lock.
+ */
+class BtEss {
+public:
+	static BtEss &Instance()
+	{
+		static BtEss sBtEss;
+		return sBtEss;
+	}
+
+	CHIP_ERROR Init();
+	/* Thread-safe. */
+	void Update(int16_t temperature, uint16_t humidity);
+	bool IsSubscribed() const;
+	void Print(const struct shell *shell);
+
+	/* Bluetooth callbacks. */
+	static void Connected(struct bt_conn *conn, uint8_t err);
+	static void Disconnected(struct bt_conn *conn, uint8_t reason);
+	static void ParamUpdated(struct bt_conn *conn, uint16_t interval, uint16_t latency, uint16_t timeout);
+	static ssize_t ReadTemperature(struct bt_conn *conn, const struct bt_gatt_attr *attr, void *buf, uint16_t len,
+				       uint16_t offset);
+	static ssize_t ReadHumidity(struct bt_conn *conn, const struct bt_gatt_attr *attr, void *buf, uint16_t len,
+				    uint16_t offset);
+	static void TemperatureCccChanged(const struct bt_gatt_attr *attr, uint16_t value);
+	static void HumidityCccChanged(const struct bt_gatt_attr *attr, uint16_t value);
+
+private:
+	using State = BtEssState<struct bt_conn>;
+
+	void StartAdvertising();
+	void StopAdvertising();
+	void OnAdvertising(bool advertising);
+	/* Returns the connection of the client with a reference taken, or nullptr. */
+	struct bt_conn *RefConnection() const;
+	void OnCccChanged(State::Characteristic characteristic, const struct bt_gatt_attr *attr);
+
+	struct bt_conn_cb mConnCallbacks {};
+
+	chip::DeviceLayer::BLEAdvertisingArbiter::Request mAdvertisingRequest{};
+	mutable struct k_spinlock mLock;
+	State mState;
+	uint16_t mInterval{ 0 };
+	int16_t mTemperature{ 0 };
+	uint16_t mHumidity{ 0 };
+	uint32_t mNotifications{ 0 };
+};
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * Connection state of the Environmental Sensing Service. The service owns at most one connection, the one made while
+ * it was the one advertising, and a subscription only counts while that connection exists: the CCC callbacks are
+ * shared by all connections, including the Matter commissioning one.
+ *
+ * The state has no dependencies on the Bluetooth stack, the connection is an opaque handle of type Conn.
+ */
+template <typename Conn> class BtEssState {
+public:
+	enum Characteristic : uint8_t { kTemperature, kHumidity, kCharacteristicCount };
+
+	/* Returns whether the connection belongs to the service, which must then cancel its advertising request. */
+	bool OnConnected(Conn *conn, bool peripheral)
+	{
+		if (conn == nullptr || !peripheral || !mAdvertising || mConn != nullptr) {
+			return false;
+		}
+
+		mConn = conn;
+		mAdvertising = false;
+		mConnections++;
+
+		return true;
+	}
+
+	/* Returns whether the service lost its connection, which must then insert its advertising request again. */
+	bool OnDisconnected(Conn *conn)
+	{
+		if (conn == nullptr || conn != mConn) {
+			return false;
+		}
+
+		mConn = nullptr;
+		for (bool &notify : mNotify) {
+			notify = false;
+		}
+
+		return true;
+	}
+
+	void OnAdvertising(bool advertising) { mAdvertising = advertising; }
+
+	/* The caller passes whether the connection of the service is subscribed, not the value shared by all. */
+	void OnCccChanged(Characteristic characteristic, bool notify)
+	{
+		mNotify[characteristic] = mConn != nullptr && notify;
+	}
+
+	bool ShouldNotify(Characteristic characteristic) const { return mConn != nullptr && mNotify[characteristic]; }
+	bool IsSubscribed() const { return ShouldNotify(kTemperature) || ShouldNotify(kHumidity); }
+	bool IsAdvertising() const { return mAdvertising; }
+	Conn *GetConnection() const { return mConn; }
+	uint32_t GetConnections() const { return mConnections; }
+
+private:
+	Conn *mConn{ nullptr };
+	bool mAdvertising{ false };
+	bool mNotify[kCharacteristicCount]{};
+	uint32_t mConnections{ 0 };
+};
@@ -14,3 +14,33 @@
  */
 
 #pragma once
+
+#ifdef CONFIG_APP_MRP_ADAPTIVE
+/*
+ * Adaptive MRP: the active retransmission interval used towards a peer is derived from the round-trip time measured
+ * on its sessions (SRTT + 4 * RTTVAR) and clamped to the bounds below. The idle interval advertised by the peer is
+ * only ever increased, so sleepy peers keep enough time to wake up.
+ */
+#define APP_MRP_ADAPTIVE_MIN_RETRY_INTERVAL_MS 200
+#define APP_MRP_ADAPTIVE_MAX_RETRY_INTERVAL_MS 5000
+/* Number of samples collected from a peer before its intervals are adapted. */
+#define APP_MRP_ADAPTIVE_MIN_SAMPLES 4
+/* Minimum relative change of the retransmission timeout that is applied to the sessions. */
+#define APP_MRP_ADAPTIVE_UPDATE_THRESHOLD_PERCENT 10
+/* Number of peers with an RTT estimate, sized for 3-5 controllers, and of outstanding messages tracked. */
+#define APP_MRP_ADAPTIVE_PEERS 5
+#define APP_MRP_ADAPTIVE_PENDING_MESSAGES 8
+#endif /* CONFIG_APP_MRP_ADAPTIVE */
+
+#if defined(CONFIG_APP_POOL_STATS) || defined(CONFIG_APP_HEAP_STATS)
+/*
+ * Counts the objects allocated from the exchange, unsolicited handler and timer pools and the packet buffers, used by
+ * the pool and heap statistics.
+ */
+#define CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS 1
+#endif /* CONFIG_APP_POOL_STATS || CONFIG_APP_HEAP_STATS */
+
+#ifdef CONFIG_APP_MRP_ANALYTICS
+/* Reports the MRP retransmissions to the radio statistics and adaptive MRP, if the Matter library supports it. */
+#define CHIP_CONFIG_MRP_ANALYTICS_ENABLED 1
+#endif /* CONFIG_APP_MRP_ANALYTICS */
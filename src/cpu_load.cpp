@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "cpu_load.h"
+#include "cpu_load_cluster.h"
+
+#include <platform/CHIPDeviceLayer.h>
+
+#include <zephyr/logging/log.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/util.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+
+namespace {
+
+constexpr uint16_t kFullLoad = 10000;
+
+struct CategoryPrefix {
+	const char *mPrefix;
+	CpuLoad::Category mCategory;
+};
+
+/* Names of the threads created by the Matter stack, the network and Bluetooth stacks and this application. */
+constexpr CategoryPrefix kCategoryPrefixes[] = {
+	{ "CHIP", CpuLoad::kMatter },	   { "openthread", CpuLoad::kNetwork }, { "ot_", CpuLoad::kNetwork },
+	{ "802154", CpuLoad::kNetwork },   { "nrf5", CpuLoad::kNetwork },	{ "net_", CpuLoad::kNetwork },
+	{ "rx_q", CpuLoad::kNetwork },	   { "tx_q", CpuLoad::kNetwork },	{ "wpa_", CpuLoad::kNetwork },
+	{ "nrf70", CpuLoad::kNetwork },	   { "wifi", CpuLoad::kNetwork },	{ "BT", CpuLoad::kBluetooth },
+	{ "bt_", CpuLoad::kBluetooth },	   { "sensor", CpuLoad::kSensor },	{ "logging", CpuLoad::kLogging },
+};
+
+constexpr const char *kCategoryNames[CpuLoad::kCategoryCount] = { "matter",  "network", "bluetooth",
+								   "sensor",  "logging", "other" };
+
+bool HasPrefix(const char *name, const char *prefix)
+{
+	return strncmp(name, prefix, strlen(prefix)) == 0;
+}
+
+CpuLoad::Category Classify(const char *name)
+{
+	for (const CategoryPrefix &entry : kCategoryPrefixes) {
+		if (HasPrefix(name, entry.mPrefix)) {
+			return entry.mCategory;
+		}
+	}
+
+	return CpuLoad::kOther;
+}
+
+uint16_t Share(uint64_t part, uint64_t whole)
+{
+	return whole ? static_cast<uint16_t>(MIN(part * kFullLoad / whole, kFullLoad)) : 0;
+}
+
+bool Differs(uint16_t a, uint16_t b)
+{
+	return static_cast<uint16_t>(abs(a - b)) >= CONFIG_APP_CPU_LOAD_REPORT_CHANGE;
+}
+
+} /* namespace */
+
+void CpuLoad::Init()
+{
+	k_work_init_delayable(&mWork, WindowHandler);
+
+	/* The first pass only takes the reference counters. */
+	Reset();
+	CloseWindow();
+	k_work_schedule(&mWork, K_SECONDS(CONFIG_APP_CPU_LOAD_WINDOW_S));
+}
+
+void CpuLoad::Reset()
+{
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+
+	mWindow = {};
+	mResetPending = true;
+
+	k_spin_unlock(&mLock, key);
+}
+
+CpuLoad::Window CpuLoad::GetWindow()
+{
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+	Window window = mWindow;
+
+	k_spin_unlock(&mLock, key);
+	return window;
+}
+
+void CpuLoad::WindowHandler(struct k_work *work)
+{
+	CpuLoad &self = Instance();
+
+	self.CloseWindow();
+	k_work_schedule(&self.mWork, K_SECONDS(CONFIG_APP_CPU_LOAD_WINDOW_S));
+}
+
+CpuLoad::ThreadLoad *CpuLoad::FindThread(k_tid_t thread)
+{
+	ThreadLoad *free = nullptr;
+
+	for (ThreadLoad &entry : mThreads) {
+		if (entry.mThread == thread) {
+			return &entry;
+		}
+
+		if (!free && !entry.mThread) {
+			free = &entry;
+		}
+	}
+
+	return free;
+}
+
+void CpuLoad::CountThread(const struct k_thread *thread, void *context)
+{
+	CpuLoad *self = static_cast<CpuLoad *>(context);
+	k_tid_t tid = const_cast<k_tid_t>(thread);
+	const char *name = k_thread_name_get(tid);
+	k_thread_runtime_stats_t stats;
+
+	if (k_thread_runtime_stats_get(tid, &stats) != 0) {
+		return;
+	}
+
+	/* The idle time is the complement of the total load. */
+	if (name && HasPrefix(name, "idle")) {
+		return;
+	}
+
+	Category category = name ? Classify(name) : kOther;
+	ThreadLoad *entry = self->FindThread(tid);
+
+	if (!entry) {
+		self->mUntracked++;
+		return;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&self->mLock);
+	bool known = entry->mThread == tid;
+	/* A thread created during the window ran only in this window. */
+	uint64_t cycles = known ? stats.execution_cycles - entry->mLastCycles :
+				  (self->mResetPending ? 0 : stats.execution_cycles);
+
+	entry->mThread = tid;
+	entry->mCategory = category;
+	entry->mLastCycles = stats.execution_cycles;
+	entry->mLoad = Share(cycles, self->mWindowCycles);
+	entry->mSeen = true;
+
+	k_spin_unlock(&self->mLock, key);
+
+	self->mCategoryCycles[category] += cycles;
+}
+
+void CpuLoad::CloseWindow()
+{
+	k_thread_runtime_stats_t all;
+
+	if (k_thread_runtime_stats_all_get(&all) != 0) {
+		return;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+	bool reference = mResetPending;
+
+	for (ThreadLoad &entry : mThreads) {
+		entry.mSeen = false;
+	}
+
+	k_spin_unlock(&mLock, key);
+
+	/* Execution cycles include the idle time, total cycles do not. */
+	mWindowCycles = all.execution_cycles - mLastTotalCycles;
+	memset(mCategoryCycles, 0, sizeof(mCategoryCycles));
+	mUntracked = 0;
+
+	k_thread_foreach_unlocked(CountThread, this);
+
+	uint64_t busyCycles = all.total_cycles - mLastBusyCycles;
+
+	mLastTotalCycles = all.execution_cycles;
+	mLastBusyCycles = all.total_cycles;
+
+	key = k_spin_lock(&mLock);
+
+	for (ThreadLoad &entry : mThreads) {
+		if (!entry.mSeen) {
+			entry.mThread = nullptr;
+		}
+	}
+
+	if (!reference) {
+		mWindow.mValid = true;
+		mWindow.mTotal = Share(busyCycles, mWindowCycles);
+		mWindow.mPeakTotal = MAX(mWindow.mPeakTotal, mWindow.mTotal);
+
+		for (size_t i = 0; i < kCategoryCount; i++) {
+			mWindow.mCategories[i] = Share(mCategoryCycles[i], mWindowCycles);
+		}
+	}
+
+	mResetPending = false;
+	Window window = mWindow;
+
+	k_spin_unlock(&mLock, key);
+
+	if (reference) {
+		return;
+	}
+
+	if (mUntracked) {
+		LOG_WRN("CPU load: %u threads not tracked, increase CONFIG_APP_CPU_LOAD_MAX_THREADS", mUntracked);
+	}
+
+	bool changed = !mReported.mValid || Differs(window.mTotal, mReported.mTotal) ||
+		       window.mPeakTotal != mReported.mPeakTotal;
+
+	for (size_t i = 0; i < kCategoryCount; i++) {
+		changed = changed || Differs(window.mCategories[i], mReported.mCategories[i]);
+	}
+
+	if (changed) {
+		mReported = window;
+		DeviceLayer::PlatformMgr().ScheduleWork([](intptr_t) { CpuLoadDiagnostics::ReportLoadChanged(); });
+	}
+}
+
+#ifdef CONFIG_SHELL
+void CpuLoad::Print(const struct shell *shell)
+{
+	ThreadLoad threads[ARRAY_SIZE(mThreads)];
+	Window window;
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+
+	memcpy(threads, mThreads, sizeof(threads));
+	window = mWindow;
+
+	k_spin_unlock(&mLock, key);
+
+	if (!window.mValid) {
+		shell_print(shell, "No window completed since the last reset");
+		return;
+	}
+
+	shell_print(shell, "window: %u s", CONFIG_APP_CPU_LOAD_WINDOW_S);
+	shell_print(shell, "%-24s %-10s %s", "thread", "category", "load [%]");
+
+	for (const ThreadLoad &entry : threads) {
+		if (!entry.mThread) {
+			continue;
+		}
+
+		const char *name = k_thread_name_get(entry.mThread);
+
+		shell_print(shell, "%-24s %-10s %u.%02u", name ? name : "?", kCategoryNames[entry.mCategory],
+			    entry.mLoad / 100, entry.mLoad % 100);
+	}
+
+	shell_print(shell, "");
+
+	for (size_t i = 0; i < kCategoryCount; i++) {
+		shell_print(shell, "%-35s %u.%02u", kCategoryNames[i], window.mCategories[i] / 100,
+			    window.mCategories[i] % 100);
+	}
+
+	shell_print(shell, "%-35s %u.%02u", "total", window.mTotal / 100, window.mTotal % 100);
+	shell_print(shell, "%-35s %u.%02u", "peak total", window.mPeakTotal / 100, window.mPeakTotal % 100);
+}
+
+static int CpuLoadShowHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	CpuLoad::Instance().Print(shell);
+	return 0;
+}
+
+static int CpuLoadResetHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	CpuLoad::Instance().Reset();
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_cpu_load,
+			       SHELL_CMD_ARG(show, NULL, "Print the CPU load of the last window per thread and subsystem",
+					     CpuLoadShowHandler, 1, 0),
+			       SHELL_CMD_ARG(reset, NULL, "Restart the measurement and clear the peak load",
+					     CpuLoadResetHandler, 1, 0),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((app), cpu, &sub_cpu_load, "CPU load accounting", NULL, 1, 0);
+#endif /* CONFIG_SHELL */
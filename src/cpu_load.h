@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+
+#include <stdint.h>
+
+struct shell;
+
+/*
+ * CPU time accounting per thread, aggregated into the share of each subsystem in windows of
+ * CONFIG_APP_CPU_LOAD_WINDOW_S. The threads are assigned to the subsystems by their names, and the time spent in
+ * interrupts is counted to the interrupted thread. The window results are exposed in the CPU Load Diagnostics
+ * cluster on endpoint 0 and printed with the "app cpu show" shell command together with the load of every thread.
+ */
+class CpuLoad {
+public:
+	enum Category : uint8_t { kMatter, kNetwork, kBluetooth, kSensor, kLogging, kOther, kCategoryCount };
+
+	/* Loads in hundredths of a percent of the window duration. */
+	struct Window {
+		bool mValid;
+		uint16_t mTotal;
+		uint16_t mPeakTotal;
+		uint16_t mCategories[kCategoryCount];
+	};
+
+	static CpuLoad &Instance()
+	{
+		static CpuLoad sCpuLoad;
+		return sCpuLoad;
+	}
+
+	void Init();
+	void Reset();
+	/* Returns the results of the last completed window. */
+	Window GetWindow();
+	void Print(const struct shell *shell);
+
+private:
+	struct ThreadLoad {
+		k_tid_t mThread;
+		uint64_t mLastCycles;
+		uint16_t mLoad;
+		Category mCategory;
+		bool mSeen;
+	};
+
+	static void WindowHandler(struct k_work *work);
+	static void CountThread(const struct k_thread *thread, void *context);
+
+	void CloseWindow();
+	ThreadLoad *FindThread(k_tid_t thread);
+
+	struct k_work_delayable mWork;
+	struct k_spinlock mLock;
+	ThreadLoad mThreads[CONFIG_APP_CPU_LOAD_MAX_THREADS];
+	uint64_t mCategoryCycles[kCategoryCount];
+	uint64_t mWindowCycles{ 0 };
+	uint64_t mLastTotalCycles{ 0 };
+	uint64_t mLastBusyCycles{ 0 };
+	Window mWindow{};
+	Window mReported{};
+	uint32_t mUntracked{ 0 };
+	bool mResetPending{ true };
+};
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "cpu_load_cluster.h"
+
+#ifdef CONFIG_APP_CPU_LOAD
+#include "cpu_load.h"
+#endif
+
+#include <app/AttributeAccessInterface.h>
+#include <app/AttributeAccessInterfaceRegistry.h>
+#include <app/data-model/Nullable.h>
+#include <app/reporting/reporting.h>
+#include <app/util/attribute-storage.h>
+
+using namespace ::chip;
+using namespace ::chip::app;
+
+namespace CpuLoadDiagnostics {
+namespace {
+
+class CpuLoadAttrAccess : public AttributeAccessInterface {
+public:
+	CpuLoadAttrAccess() : AttributeAccessInterface(MakeOptional(kRootEndpointId), kClusterId) {}
+
+	CHIP_ERROR Read(const ConcreteReadAttributePath &path, AttributeValueEncoder &encoder) override
+	{
+		if (path.mAttributeId == Attributes::kWindowDuration) {
+#ifdef CONFIG_APP_CPU_LOAD
+			return encoder.Encode(static_cast<uint16_t>(CONFIG_APP_CPU_LOAD_WINDOW_S));
+#else
+			return encoder.Encode(static_cast<uint16_t>(0));
+#endif
+		}
+
+		if (path.mAttributeId < Attributes::kTotalLoad || path.mAttributeId > Attributes::kLastCategoryLoad) {
+			/* Global attributes are served from the attribute storage. */
+			return CHIP_NO_ERROR;
+		}
+
+		DataModel::Nullable<uint16_t> load;
+
+#ifdef CONFIG_APP_CPU_LOAD
+		CpuLoad::Window window = CpuLoad::Instance().GetWindow();
+
+		if (window.mValid) {
+			if (path.mAttributeId == Attributes::kTotalLoad) {
+				load.SetNonNull(window.mTotal);
+			} else if (path.mAttributeId == Attributes::kPeakTotalLoad) {
+				load.SetNonNull(window.mPeakTotal);
+			} else {
+				load.SetNonNull(window.mCategories[path.mAttributeId - Attributes::kFirstCategoryLoad]);
+			}
+		}
+#endif
+		return encoder.Encode(load);
+	}
+};
+
+CpuLoadAttrAccess sAttrAccess;
+
+} /* namespace */
+
+void ReportLoadChanged()
+{
+	for (AttributeId id = Attributes::kTotalLoad; id <= Attributes::kLastCategoryLoad; id++) {
+		MatterReportingAttributeChangeCallback(kRootEndpointId, kClusterId, id);
+	}
+}
+
+} /* namespace CpuLoadDiagnostics */
+
+void MatterCpuLoadDiagnosticsPluginServerInitCallback()
+{
+	AttributeAccessInterfaceRegistry::Instance().Register(&CpuLoadDiagnostics::sAttrAccess);
+}
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <lib/core/DataModelTypes.h>
+
+/*
+ * Manufacturer specific CPU Load Diagnostics cluster on endpoint 0, defined in
+ * src/default_zap/cpu-load-diagnostics-cluster.xml. The loads are in hundredths of a percent of the CPU time in the
+ * last completed measurement window of CpuLoad, and are null when CONFIG_APP_CPU_LOAD is disabled.
+ */
+namespace CpuLoadDiagnostics {
+
+inline constexpr chip::ClusterId kClusterId = 0xFFF1FC40;
+
+namespace Attributes {
+inline constexpr chip::AttributeId kWindowDuration = 0x0000;
+inline constexpr chip::AttributeId kTotalLoad = 0x0001;
+inline constexpr chip::AttributeId kPeakTotalLoad = 0x0002;
+/* The loads of the CpuLoad categories, in the order of CpuLoad::Category. */
+inline constexpr chip::AttributeId kFirstCategoryLoad = 0x0003;
+inline constexpr chip::AttributeId kLastCategoryLoad = 0x0008;
+} /* namespace Attributes */
+
+/* Notifies the subscribers that a new window completed. Must be called on the Matter thread. */
+void ReportLoadChanged();
+
+} /* namespace CpuLoadDiagnostics */
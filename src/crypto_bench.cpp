@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <crypto/DefaultSessionKeystore.h>
+#if CHIP_CRYPTO_PSA_SPAKE2P
+#include <crypto/PSASpake2p.h>
+#endif
+
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/timing/timing.h>
+
+#include <errno.h>
+#include <stdlib.h>
+
+using namespace ::chip;
+using namespace ::chip::Crypto;
+
+/*
+ * Benchmark of the cryptographic operations that dominate the PASE commissioning and CASE session establishment
+ * times. The operations are run through the Matter crypto layer, which uses the PSA Crypto API, so the results show
+ * the performance of the PSA driver selected in the build (e.g. the cc3xx_backend variant of sample.yaml) exactly
+ * as the Matter stack sees it. Run it on an idle device, the shell thread competes with the other threads.
+ */
+
+namespace {
+
+#if CHIP_CRYPTO_PSA_SPAKE2P
+using Spake2p = PSASpake2p_P256_SHA256_HKDF_HMAC;
+#else
+using Spake2p = Spake2p_P256_SHA256_HKDF_HMAC;
+#endif
+
+constexpr uint32_t kSetupPasscode = 20202021;
+constexpr uint32_t kPbkdfIterations = 1000;
+constexpr uint8_t kPbkdfSalt[] = "SPAKE2P Key Salt";
+constexpr size_t kSessionKeysLength = 3 * CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES;
+
+/* Measures the part of an operation done by the device, e.g. only the verifier side of a SPAKE2+ exchange. */
+class Stopwatch {
+public:
+	void Start() { mStart = timing_counter_get(); }
+
+	void Stop()
+	{
+		timing_t end = timing_counter_get();
+
+		mCycles += timing_cycles_get(&mStart, &end);
+	}
+
+	uint64_t Cycles() const { return mCycles; }
+
+private:
+	timing_t mStart;
+	uint64_t mCycles{ 0 };
+};
+
+struct Bench {
+	P256Keypair mKeypair;
+	P256Keypair mPeerKeypair;
+	P256ECDSASignature mSignature;
+	P256ECDHDerivedSecret mSecret;
+	DefaultSessionKeystore mKeystore;
+	Aes128KeyHandle mKey;
+	Spake2pVerifier mVerifier;
+	uint8_t mWs[2 * kSpake2p_WS_Length];
+	Spake2p mProver;
+	Spake2p mDeviceVerifier;
+	uint8_t mMessage[CONFIG_APP_CRYPTO_BENCH_PAYLOAD_SIZE];
+	uint8_t mCiphertext[CONFIG_APP_CRYPTO_BENCH_PAYLOAD_SIZE];
+	uint8_t mTag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+	uint8_t mNonce[CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES];
+	uint8_t mSessionKeys[kSessionKeysLength];
+};
+
+/* Large enough to not fit on the shell thread stack. */
+Bench sBench;
+
+CHIP_ERROR Setup(Bench &bench)
+{
+	Symmetric128BitsKeyByteArray keyMaterial;
+
+	ReturnErrorOnFailure(bench.mKeypair.Initialize(ECPKeyTarget::ECDSA));
+	ReturnErrorOnFailure(bench.mPeerKeypair.Initialize(ECPKeyTarget::ECDH));
+	ReturnErrorOnFailure(DRBG_get_bytes(bench.mMessage, sizeof(bench.mMessage)));
+	ReturnErrorOnFailure(DRBG_get_bytes(bench.mNonce, sizeof(bench.mNonce)));
+	ReturnErrorOnFailure(DRBG_get_bytes(keyMaterial, sizeof(keyMaterial)));
+	ReturnErrorOnFailure(bench.mKeystore.CreateKey(keyMaterial, bench.mKey));
+
+	/* The device gets the verifier from the factory data, the controller computes w0 and w1 from the passcode. */
+	ReturnErrorOnFailure(bench.mVerifier.Generate(kPbkdfIterations, ByteSpan(kPbkdfSalt), kSetupPasscode));
+	return Spake2pVerifier::ComputeWS(kPbkdfIterations, ByteSpan(kPbkdfSalt), kSetupPasscode, bench.mWs,
+					  sizeof(bench.mWs));
+}
+
+CHIP_ERROR P256Keygen(Bench &bench, Stopwatch &watch)
+{
+	P256Keypair keypair;
+	CHIP_ERROR err;
+
+	watch.Start();
+	err = keypair.Initialize(ECPKeyTarget::ECDH);
+	watch.Stop();
+
+	return err;
+}
+
+CHIP_ERROR EcdsaSign(Bench &bench, Stopwatch &watch)
+{
+	CHIP_ERROR err;
+
+	watch.Start();
+	err = bench.mKeypair.ECDSA_sign_msg(bench.mMessage, sizeof(bench.mMessage), bench.mSignature);
+	watch.Stop();
+
+	return err;
+}
+
+CHIP_ERROR EcdsaVerify(Bench &bench, Stopwatch &watch)
+{
+	CHIP_ERROR err;
+
+	watch.Start();
+	err = bench.mKeypair.Pubkey().ECDSA_validate_msg_signature(bench.mMessage, sizeof(bench.mMessage),
+								   bench.mSignature);
+	watch.Stop();
+
+	return err;
+}
+
+CHIP_ERROR Ecdh(Bench &bench, Stopwatch &watch)
+{
+	CHIP_ERROR err;
+
+	watch.Start();
+	err = bench.mPeerKeypair.ECDH_derive_secret(bench.mKeypair.Pubkey(), bench.mSecret);
+	watch.Stop();
+
+	return err;
+}
+
+/* Runs a whole PASE key exchange, of which only the verifier side is measured. */
+CHIP_ERROR Spake2pExchange(Bench &bench, Stopwatch &watch)
+{
+	uint8_t context[kSHA256_Hash_Length] = {};
+	uint8_t pA[kMAX_Point_Length];
+	uint8_t pB[kMAX_Point_Length];
+	uint8_t cA[kMAX_Hash_Length];
+	uint8_t cB[kMAX_Hash_Length];
+	size_t pALength = sizeof(pA);
+	size_t pBLength = sizeof(pB);
+	size_t cALength = sizeof(cA);
+	size_t cBLength = sizeof(cB);
+	CHIP_ERROR err;
+
+	ReturnErrorOnFailure(bench.mProver.Init(context, sizeof(context)));
+	ReturnErrorOnFailure(bench.mProver.BeginProver(nullptr, 0, nullptr, 0, &bench.mWs[0], kSpake2p_WS_Length,
+						       &bench.mWs[kSpake2p_WS_Length], kSpake2p_WS_Length));
+	ReturnErrorOnFailure(bench.mProver.ComputeRoundOne(nullptr, 0, pA, &pALength));
+
+	watch.Start();
+	err = bench.mDeviceVerifier.Init(context, sizeof(context));
+	SuccessOrExit(err);
+	err = bench.mDeviceVerifier.BeginVerifier(nullptr, 0, nullptr, 0, bench.mVerifier.mW0, kP256_FE_Length,
+						  bench.mVerifier.mL, kP256_Point_Length);
+	SuccessOrExit(err);
+	err = bench.mDeviceVerifier.ComputeRoundOne(pA, pALength, pB, &pBLength);
+	SuccessOrExit(err);
+	err = bench.mDeviceVerifier.ComputeRoundTwo(pA, pALength, cB, &cBLength);
+	watch.Stop();
+	SuccessOrExit(err);
+
+	err = bench.mProver.ComputeRoundTwo(pB, pBLength, cA, &cALength);
+	SuccessOrExit(err);
+	err = bench.mProver.KeyConfirm(cB, cBLength);
+	SuccessOrExit(err);
+
+	watch.Start();
+	err = bench.mDeviceVerifier.KeyConfirm(cA, cALength);
+	watch.Stop();
+
+exit:
+	bench.mProver.Clear();
+	bench.mDeviceVerifier.Clear();
+	return err;
+}
+
+CHIP_ERROR AesCcmEncrypt(Bench &bench, Stopwatch &watch)
+{
+	CHIP_ERROR err;
+
+	watch.Start();
+	err = AES_CCM_encrypt(bench.mMessage, sizeof(bench.mMessage), nullptr, 0, bench.mKey, bench.mNonce,
+			      sizeof(bench.mNonce), bench.mCiphertext, bench.mTag, sizeof(bench.mTag));
+	watch.Stop();
+
+	return err;
+}
+
+CHIP_ERROR AesCcmDecrypt(Bench &bench, Stopwatch &watch)
+{
+	CHIP_ERROR err;
+
+	watch.Start();
+	err = AES_CCM_decrypt(bench.mCiphertext, sizeof(bench.mCiphertext), nullptr, 0, bench.mTag, sizeof(bench.mTag),
+			      bench.mKey, bench.mNonce, sizeof(bench.mNonce), bench.mMessage);
+	watch.Stop();
+
+	return err;
+}
+
+/* Derives the session keys from the shared secret, as done at the end of every session establishment. */
+CHIP_ERROR HkdfSha256(Bench &bench, Stopwatch &watch)
+{
+	static constexpr uint8_t kInfo[] = "SessionKeys";
+	HKDF_sha hkdf;
+	CHIP_ERROR err;
+
+	watch.Start();
+	err = hkdf.HKDF_SHA256(bench.mSecret.ConstBytes(), bench.mSecret.Length(), bench.mMessage, kSHA256_Hash_Length,
+			       kInfo, sizeof(kInfo) - 1, bench.mSessionKeys, sizeof(bench.mSessionKeys));
+	watch.Stop();
+
+	return err;
+}
+
+struct Operation {
+	const char *mName;
+	CHIP_ERROR (*mRun)(Bench &bench, Stopwatch &watch);
+};
+
+/* In this order, as some operations use the results of the previous ones. */
+constexpr Operation kOperations[] = {
+	{ "p256_keygen", P256Keygen },
+	{ "ecdsa_sign", EcdsaSign },
+	{ "ecdsa_verify", EcdsaVerify },
+	{ "ecdh", Ecdh },
+	{ "spake2p_verifier", Spake2pExchange },
+	{ "aes_ccm_encrypt", AesCcmEncrypt },
+	{ "aes_ccm_decrypt", AesCcmDecrypt },
+	{ "hkdf_sha256", HkdfSha256 },
+};
+
+const char *BackendName()
+{
+#if defined(CONFIG_PSA_CRYPTO_DRIVER_CRACEN)
+	return "cracen";
+#elif defined(CONFIG_PSA_CRYPTO_DRIVER_CC3XX)
+	return "cc3xx";
+#else
+	return "oberon";
+#endif
+}
+
+int CryptoBenchHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	uint32_t iterations = argc > 1 ? strtoul(argv[1], nullptr, 10) : 20;
+	CHIP_ERROR err;
+
+	if (iterations == 0) {
+		shell_error(shell, "Invalid number of iterations");
+		return -EINVAL;
+	}
+
+	timing_init();
+	timing_start();
+
+	err = Setup(sBench);
+	if (err != CHIP_NO_ERROR) {
+		shell_error(shell, "Setup failed: %" CHIP_ERROR_FORMAT, err.Format());
+		goto exit;
+	}
+
+	shell_print(shell, "backend: %s, %u iterations, payload %u B", BackendName(), iterations,
+		    CONFIG_APP_CRYPTO_BENCH_PAYLOAD_SIZE);
+	shell_print(shell, "%-17s %-11s %-9s %-8s", "operation", "cycles", "us", "ops/s");
+
+	for (const Operation &operation : kOperations) {
+		Stopwatch watch;
+		uint64_t cycles;
+		uint64_t ns;
+
+		for (uint32_t i = 0; i < iterations && err == CHIP_NO_ERROR; i++) {
+			err = operation.mRun(sBench, watch);
+		}
+
+		if (err != CHIP_NO_ERROR) {
+			shell_error(shell, "%s: failed: %" CHIP_ERROR_FORMAT, operation.mName, err.Format());
+			err = CHIP_NO_ERROR;
+			continue;
+		}
+
+		cycles = watch.Cycles() / iterations;
+		ns = timing_cycles_to_ns(cycles);
+		shell_print(shell, "%-17s %-11u %-9u %-8u", operation.mName, static_cast<unsigned>(cycles),
+			    static_cast<unsigned>(ns / NSEC_PER_USEC),
+			    ns ? static_cast<unsigned>(NSEC_PER_SEC / ns) : 0);
+	}
+
+exit:
+	sBench.mKeystore.DestroyKey(sBench.mKey);
+	sBench.mKeypair.Clear();
+	sBench.mPeerKeypair.Clear();
+	timing_stop();
+
+	return err == CHIP_NO_ERROR ? 0 : -EIO;
+}
+
+} /* namespace */
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_crypto,
+			       SHELL_CMD_ARG(bench, NULL,
+					     "Measure the Matter crypto operations. Usage: bench [iterations]",
+					     CryptoBenchHandler, 1, 1),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((app), crypto, &sub_crypto, "Crypto backend benchmark", NULL, 1, 0);
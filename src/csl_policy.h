@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * Selection of the CSL (coordinated sampled listening) period from the sensor sampling cadence. The period is the
+ * longest one that divides the sample period into whole windows and does not exceed the allowed maximum, so that once
+ * a sample is aligned with a receive window, the following ones stay aligned. The period is expressed
+ * in units of 10 symbols (160 us), which is the granularity of the CSL IE.
+ */
+namespace CslPolicy {
+
+constexpr uint32_t kUnitUs = 160;
+
+inline uint32_t PeriodUs(uint32_t samplePeriodMs, uint32_t maxPeriodMs)
+{
+	uint32_t windows;
+
+	if (samplePeriodMs == 0 || maxPeriodMs == 0) {
+		return 0;
+	}
+
+	windows = (samplePeriodMs + maxPeriodMs - 1) / maxPeriodMs;
+
+	/* Prefer a window count giving an exact number of CSL units, so the phase does not slip over time. */
+	for (uint32_t count = windows; count < windows * 2; count++) {
+		uint64_t sampleUs = static_cast<uint64_t>(samplePeriodMs) * 1000;
+
+		if (sampleUs % (static_cast<uint64_t>(count) * kUnitUs) == 0) {
+			return static_cast<uint32_t>(sampleUs / count);
+		}
+	}
+
+	return static_cast<uint32_t>(static_cast<uint64_t>(samplePeriodMs) * 1000 / windows / kUnitUs * kUnitUs);
+}
+
+/*
+ * Delay until the receive window nearest to nowUs + delayUs, on the grid of windows repeating every periodUs from
+ * anchorUs. The sample never moves before nowUs.
+ */
+inline uint64_t AlignDelayUs(uint64_t nowUs, uint64_t anchorUs, uint32_t periodUs, uint64_t delayUs)
+{
+	uint64_t offset;
+
+	if (periodUs == 0 || nowUs < anchorUs) {
+		return delayUs;
+	}
+
+	offset = (nowUs + delayUs - anchorUs) % periodUs;
+
+	if (offset * 2 <= periodUs && offset <= delayUs) {
+		return delayUs - offset;
+	}
+
+	return delayUs + (periodUs - offset);
+}
+
+/* Radio-on time per hour spent in receive windows or polls, each costing the given on-time. */
+inline uint32_t RadioOnMsPerHour(uint32_t periodUs, uint32_t onTimeUs)
+{
+	if (periodUs == 0) {
+		return 0;
+	}
+
+	return static_cast<uint32_t>(3600ULL * 1000 * 1000 / periodUs * onTimeUs / 1000);
+}
+
+} /* namespace CslPolicy */
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "csl_scheduler.h"
+#include "csl_policy.h"
+
+#include <app/server/Server.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <openthread/link.h>
+#include <openthread/platform/radio.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/net/openthread.h>
+#include <zephyr/shell/shell.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+
+CHIP_ERROR CslScheduler::Init(uint32_t samplePeriodMs)
+{
+	mSamplePeriodMs = samplePeriodMs;
+	mPeriodUs = CslPolicy::PeriodUs(samplePeriodMs, CONFIG_APP_CSL_MAX_PERIOD_MS);
+
+	return Server::GetInstance().GetICDManager().RegisterObserver(this);
+}
+
+uint64_t CslScheduler::OnSample(uint32_t samplePeriodMs)
+{
+	struct openthread_context *context = openthread_get_default_context();
+	uint64_t delayUs = static_cast<uint64_t>(samplePeriodMs) * USEC_PER_MSEC;
+
+	DeviceLayer::PlatformMgr().ScheduleWork(SampleWork, static_cast<intptr_t>(samplePeriodMs));
+
+	openthread_api_mutex_lock(context);
+
+	/* Someone else may have changed the period since it was anchored, the grid is then unknown. */
+	uint32_t periodUs = otLinkGetCslPeriod(context->instance);
+
+	if (mAnchored && periodUs == mPeriodUs) {
+		delayUs = CslPolicy::AlignDelayUs(otPlatRadioGetNow(context->instance), mAnchorUs, periodUs, delayUs);
+		mAlignedSamples++;
+	}
+
+	openthread_api_mutex_unlock(context);
+
+	return delayUs;
+}
+
+void CslScheduler::SampleWork(intptr_t context)
+{
+	CslScheduler &scheduler = Instance();
+	uint32_t samplePeriodMs = static_cast<uint32_t>(context);
+
+	if (samplePeriodMs == scheduler.mSamplePeriodMs) {
+		return;
+	}
+
+	scheduler.mSamplePeriodMs = samplePeriodMs;
+	scheduler.mPeriodUs = CslPolicy::PeriodUs(samplePeriodMs, CONFIG_APP_CSL_MAX_PERIOD_MS);
+
+	if (scheduler.mIdle) {
+		scheduler.Apply();
+	}
+}
+
+void CslScheduler::OnEnterActiveMode()
+{
+	struct openthread_context *context = openthread_get_default_context();
+
+	mIdle = false;
+
+	openthread_api_mutex_lock(context);
+	mAnchored = false;
+	openthread_api_mutex_unlock(context);
+}
+
+void CslScheduler::OnEnterIdleMode()
+{
+	mIdle = true;
+
+	/* The ICD manager has just restored its own slow period, replace it. */
+	Apply();
+}
+
+void CslScheduler::Apply()
+{
+	struct openthread_context *context = openthread_get_default_context();
+	otError error = OT_ERROR_NONE;
+
+	if (mPeriodUs == 0) {
+		return;
+	}
+
+	openthread_api_mutex_lock(context);
+
+	/*
+	 * Setting the same period again does not restart the CSL schedule, so the samples are only aligned when the
+	 * period is actually changed here.
+	 */
+	if (otLinkGetCslPeriod(context->instance) != mPeriodUs) {
+		error = otLinkSetCslPeriod(context->instance, mPeriodUs);
+
+		if (error == OT_ERROR_NONE) {
+			mAnchorUs = otPlatRadioGetNow(context->instance);
+			mAnchored = true;
+			mPeriodUpdates++;
+		}
+	}
+
+	openthread_api_mutex_unlock(context);
+
+	if (error != OT_ERROR_NONE) {
+		LOG_ERR("Failed to set the CSL period: %d", error);
+	}
+}
+
+#ifdef CONFIG_SHELL
+void CslScheduler::Print(const struct shell *shell)
+{
+	uint32_t cslMs = CslPolicy::RadioOnMsPerHour(mPeriodUs, CONFIG_APP_CSL_WINDOW_US);
+	uint32_t pollMs = CslPolicy::RadioOnMsPerHour(mPeriodUs, CONFIG_APP_CSL_POLL_RADIO_ON_US);
+
+	shell_print(shell, "sample period: %u ms, CSL period: %u us, idle: %s", mSamplePeriodMs, mPeriodUs,
+		    mIdle ? "yes" : "no");
+	shell_print(shell, "period updates: %u, aligned samples: %u", mPeriodUpdates, mAlignedSamples);
+	shell_print(shell, "estimated radio-on per hour: CSL %u ms, polling at the same latency %u ms", cslMs, pollMs);
+}
+
+static int CslSchedulerShowHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::StackLock lock;
+
+	CslScheduler::Instance().Print(shell);
+	return 0;
+}
+
+SHELL_SUBCMD_ADD((app), csl, NULL, "Print CSL scheduler state", CslSchedulerShowHandler, 1, 0);
+#endif /* CONFIG_SHELL */
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <app/icd/server/ICDStateObserver.h>
+
+#include <stdint.h>
+
+struct shell;
+
+/*
+ * Aligns the Thread CSL receive windows of a synchronized sleepy end device with the sensor sampling cadence. While
+ * the ICD is in idle mode, the CSL period is derived from the sample period, and the sensor thread moves every sample
+ * to the nearest receive window, so the radio listens when the device is awake for sampling anyway. The window grid
+ * is anchored to the radio time at which the period was set, which is when OpenThread restarts its CSL sample
+ * schedule. The period is only written when it differs from the one OpenThread uses, so no CSL update is sent to
+ * the parent while the sample period stays the same. In active mode the ICD manager keeps control of the period.
+ */
+class CslScheduler : public chip::app::ICDStateObserver {
+public:
+	static CslScheduler &Instance()
+	{
+		static CslScheduler sCslScheduler;
+		return sCslScheduler;
+	}
+
+	CHIP_ERROR Init(uint32_t samplePeriodMs);
+	void Print(const struct shell *shell);
+
+	/* Thread-safe, called by the sensor thread after every sample. Returns the time until the next sample. */
+	uint64_t OnSample(uint32_t samplePeriodMs);
+
+	/* chip::app::ICDStateObserver */
+	void OnEnterActiveMode() override;
+	void OnEnterIdleMode() override;
+	void OnTransitionToIdle() override {}
+	void OnICDModeChange() override {}
+
+private:
+	static void SampleWork(intptr_t context);
+
+	void Apply();
+
+	uint32_t mSamplePeriodMs{ 0 };
+	uint32_t mPeriodUs{ 0 };
+	bool mIdle{ false };
+	/* The anchor is shared with the sensor thread and protected by the OpenThread API mutex. */
+	bool mAnchored{ false };
+	uint64_t mAnchorUs{ 0 };
+	uint32_t mPeriodUpdates{ 0 };
+	uint32_t mAlignedSamples{ 0 };
+};
@@ -29,6 +29,7 @@
 
 // Parallel array data (*cluster*, attribute, privilege) for read attribute
 #define GENERATED_ACCESS_READ_ATTRIBUTE__CLUSTER { \
+    /* Cluster: Binding, Attribute: Binding, Privilege: view */ \
     0x0000001F, /* Cluster: Access Control, Attribute: ACL, Privilege: administer */ \
     0x0000001F, /* Cluster: Access Control, Attribute: Extension, Privilege: administer */ \
     /* Cluster: Basic Information, Attribute: NodeLabel, Privilege: view */ \
@@ -47,6 +48,7 @@
 
 // Parallel array data (cluster, *attribute*, privilege) for read attribute
 #define GENERATED_ACCESS_READ_ATTRIBUTE__ATTRIBUTE { \
+    /* Cluster: Binding, Attribute: Binding, Privilege: view */ \
     0x00000000, /* Cluster: Access Control, Attribute: ACL, Privilege: administer */ \
     0x00000001, /* Cluster: Access Control, Attribute: Extension, Privilege: administer */ \
     /* Cluster: Basic Information, Attribute: NodeLabel, Privilege: view */ \
@@ -65,6 +67,7 @@
 
 // Parallel array data (cluster, attribute, *privilege*) for read attribute
 #define GENERATED_ACCESS_READ_ATTRIBUTE__PRIVILEGE { \
+    /* Cluster: Binding, Attribute: Binding, Privilege: view */ \
     chip::Access::Privilege::kAdminister, /* Cluster: Access Control, Attribute: ACL, Privilege: administer */ \
     chip::Access::Privilege::kAdminister, /* Cluster: Access Control, Attribute: Extension, Privilege: administer */ \
     /* Cluster: Basic Information, Attribute: NodeLabel, Privilege: view */ \
@@ -85,6 +88,7 @@
 
 // Parallel array data (*cluster*, attribute, privilege) for write attribute
 #define GENERATED_ACCESS_WRITE_ATTRIBUTE__CLUSTER { \
+    0x0000001E, /* Cluster: Binding, Attribute: Binding, Privilege: manage */ \
     0x0000001F, /* Cluster: Access Control, Attribute: ACL, Privilege: administer */ \
     0x0000001F, /* Cluster: Access Control, Attribute: Extension, Privilege: administer */ \
     0x00000028, /* Cluster: Basic Information, Attribute: NodeLabel, Privilege: manage */ \
@@ -93,10 +97,16 @@
     0x00000030, /* Cluster: General Commissioning, Attribute: Breadcrumb, Privilege: administer */ \
     0x00000031, /* Cluster: Network Commissioning, Attribute: InterfaceEnabled, Privilege: administer */ \
     0x0000003F, /* Cluster: Group Key Management, Attribute: GroupKeyMap, Privilege: manage */ \
+    0xFFF1FC43, /* Cluster: Sensor Configuration, Attribute: SamplePeriod, Privilege: manage */ \
+    0xFFF1FC43, /* Cluster: Sensor Configuration, Attribute: TemperatureDeadband, Privilege: manage */ \
+    0xFFF1FC43, /* Cluster: Sensor Configuration, Attribute: HumidityDeadband, Privilege: manage */ \
+    0xFFF1FC43, /* Cluster: Sensor Configuration, Attribute: FilterType, Privilege: manage */ \
+    0xFFF1FC43, /* Cluster: Sensor Configuration, Attribute: HistoryDecimation, Privilege: manage */ \
 }
 
 // Parallel array data (cluster, *attribute*, privilege) for write attribute
 #define GENERATED_ACCESS_WRITE_ATTRIBUTE__ATTRIBUTE { \
+    0x00000000, /* Cluster: Binding, Attribute: Binding, Privilege: manage */ \
     0x00000000, /* Cluster: Access Control, Attribute: ACL, Privilege: administer */ \
     0x00000001, /* Cluster: Access Control, Attribute: Extension, Privilege: administer */ \
     0x00000005, /* Cluster: Basic Information, Attribute: NodeLabel, Privilege: manage */ \
@@ -105,10 +115,16 @@
     0x00000000, /* Cluster: General Commissioning, Attribute: Breadcrumb, Privilege: administer */ \
     0x00000004, /* Cluster: Network Commissioning, Attribute: InterfaceEnabled, Privilege: administer */ \
     0x00000000, /* Cluster: Group Key Management, Attribute: GroupKeyMap, Privilege: manage */ \
+    0x00000000, /* Cluster: Sensor Configuration, Attribute: SamplePeriod, Privilege: manage */ \
+    0x00000001, /* Cluster: Sensor Configuration, Attribute: TemperatureDeadband, Privilege: manage */ \
+    0x00000002, /* Cluster: Sensor Configuration, Attribute: HumidityDeadband, Privilege: manage */ \
+    0x00000003, /* Cluster: Sensor Configuration, Attribute: FilterType, Privilege: manage */ \
+    0x00000004, /* Cluster: Sensor Configuration, Attribute: HistoryDecimation, Privilege: manage */ \
 }
 
 // Parallel array data (cluster, attribute, *privilege*) for write attribute
 #define GENERATED_ACCESS_WRITE_ATTRIBUTE__PRIVILEGE { \
+    chip::Access::Privilege::kManage, /* Cluster: Binding, Attribute: Binding, Privilege: manage */ \
     chip::Access::Privilege::kAdminister, /* Cluster: Access Control, Attribute: ACL, Privilege: administer */ \
     chip::Access::Privilege::kAdminister, /* Cluster: Access Control, Attribute: Extension, Privilege: administer */ \
     chip::Access::Privilege::kManage, /* Cluster: Basic Information, Attribute: NodeLabel, Privilege: manage */ \
@@ -117,6 +133,11 @@
     chip::Access::Privilege::kAdminister, /* Cluster: General Commissioning, Attribute: Breadcrumb, Privilege: administer */ \
     chip::Access::Privilege::kAdminister, /* Cluster: Network Commissioning, Attribute: InterfaceEnabled, Privilege: administer */ \
     chip::Access::Privilege::kManage, /* Cluster: Group Key Management, Attribute: GroupKeyMap, Privilege: manage */ \
+    chip::Access::Privilege::kManage, /* Cluster: Sensor Configuration, Attribute: SamplePeriod, Privilege: manage */ \
+    chip::Access::Privilege::kManage, /* Cluster: Sensor Configuration, Attribute: TemperatureDeadband, Privilege: manage */ \
+    chip::Access::Privilege::kManage, /* Cluster: Sensor Configuration, Attribute: HumidityDeadband, Privilege: manage */ \
+    chip::Access::Privilege::kManage, /* Cluster: Sensor Configuration, Attribute: FilterType, Privilege: manage */ \
+    chip::Access::Privilege::kManage, /* Cluster: Sensor Configuration, Attribute: HistoryDecimation, Privilege: manage */ \
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -23,6 +23,7 @@
 /**** Cluster endpoint counts ****/
 #define MATTER_DM_IDENTIFY_CLUSTER_SERVER_ENDPOINT_COUNT (1)
 #define MATTER_DM_DESCRIPTOR_CLUSTER_SERVER_ENDPOINT_COUNT (2)
+#define MATTER_DM_BINDING_CLUSTER_SERVER_ENDPOINT_COUNT (1)
 #define MATTER_DM_ACCESS_CONTROL_CLUSTER_SERVER_ENDPOINT_COUNT (1)
 #define MATTER_DM_BASIC_INFORMATION_CLUSTER_SERVER_ENDPOINT_COUNT (1)
 #define MATTER_DM_OTA_SOFTWARE_UPDATE_PROVIDER_CLUSTER_CLIENT_ENDPOINT_COUNT (1)
@@ -33,8 +34,13 @@
 #define MATTER_DM_ADMINISTRATOR_COMMISSIONING_CLUSTER_SERVER_ENDPOINT_COUNT (1)
 #define MATTER_DM_OPERATIONAL_CREDENTIALS_CLUSTER_SERVER_ENDPOINT_COUNT (1)
 #define MATTER_DM_GROUP_KEY_MANAGEMENT_CLUSTER_SERVER_ENDPOINT_COUNT (1)
+#define MATTER_DM_CPU_LOAD_DIAGNOSTICS_CLUSTER_SERVER_ENDPOINT_COUNT (1)
+#define MATTER_DM_MEMORY_DIAGNOSTICS_CLUSTER_SERVER_ENDPOINT_COUNT (1)
+#define MATTER_DM_RADIO_DIAGNOSTICS_CLUSTER_SERVER_ENDPOINT_COUNT (1)
 #define MATTER_DM_TEMPERATURE_MEASUREMENT_CLUSTER_SERVER_ENDPOINT_COUNT (1)
 #define MATTER_DM_RELATIVE_HUMIDITY_MEASUREMENT_CLUSTER_SERVER_ENDPOINT_COUNT (1)
+#define MATTER_DM_SENSOR_CONFIGURATION_CLUSTER_SERVER_ENDPOINT_COUNT (1)
+#define MATTER_DM_MEASUREMENT_SINK_CLUSTER_CLIENT_ENDPOINT_COUNT (1)
 
 /**** Cluster Plugins ****/
 
@@ -50,6 +56,12 @@
 #define MATTER_DM_PLUGIN_DESCRIPTOR
 
 
+// Use this macro to check if the server side of the Binding cluster is included
+#define ZCL_USING_BINDING_CLUSTER_SERVER
+#define MATTER_DM_PLUGIN_BINDING_SERVER
+#define MATTER_DM_PLUGIN_BINDING
+
+
 // Use this macro to check if the server side of the Access Control cluster is included
 #define ZCL_USING_ACCESS_CONTROL_CLUSTER_SERVER
 #define MATTER_DM_PLUGIN_ACCESS_CONTROL_SERVER
@@ -109,6 +121,24 @@
 #define MATTER_DM_PLUGIN_GROUP_KEY_MANAGEMENT
 
 
+// Use this macro to check if the server side of the CPU Load Diagnostics cluster is included
+#define ZCL_USING_CPU_LOAD_DIAGNOSTICS_CLUSTER_SERVER
+#define MATTER_DM_PLUGIN_CPU_LOAD_DIAGNOSTICS_SERVER
+#define MATTER_DM_PLUGIN_CPU_LOAD_DIAGNOSTICS
+
+
+// Use this macro to check if the server side of the Memory Diagnostics cluster is included
+#define ZCL_USING_MEMORY_DIAGNOSTICS_CLUSTER_SERVER
+#define MATTER_DM_PLUGIN_MEMORY_DIAGNOSTICS_SERVER
+#define MATTER_DM_PLUGIN_MEMORY_DIAGNOSTICS
+
+
+// Use this macro to check if the server side of the Radio Diagnostics cluster is included
+#define ZCL_USING_RADIO_DIAGNOSTICS_CLUSTER_SERVER
+#define MATTER_DM_PLUGIN_RADIO_DIAGNOSTICS_SERVER
+#define MATTER_DM_PLUGIN_RADIO_DIAGNOSTICS
+
+
 // Use this macro to check if the server side of the Temperature Measurement cluster is included
 #define ZCL_USING_TEMPERATURE_MEASUREMENT_CLUSTER_SERVER
 #define MATTER_DM_PLUGIN_TEMPERATURE_MEASUREMENT_SERVER
@@ -120,3 +150,14 @@
 #define MATTER_DM_PLUGIN_RELATIVE_HUMIDITY_MEASUREMENT_SERVER
 #define MATTER_DM_PLUGIN_RELATIVE_HUMIDITY_MEASUREMENT
 
+
+// Use this macro to check if the server side of the Sensor Configuration cluster is included
+#define ZCL_USING_SENSOR_CONFIGURATION_CLUSTER_SERVER
+#define MATTER_DM_PLUGIN_SENSOR_CONFIGURATION_SERVER
+#define MATTER_DM_PLUGIN_SENSOR_CONFIGURATION
+
+
+// Use this macro to check if the client side of the Measurement Sink cluster is included
+#define ZCL_USING_MEASUREMENT_SINK_CLUSTER_CLIENT
+#define MATTER_DM_PLUGIN_MEASUREMENT_SINK_CLIENT
+
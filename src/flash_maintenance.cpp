@@ -0,0 +1,441 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "flash_maintenance.h"
+
+#ifdef CONFIG_APP_OTA_WRITER
+#include "ota_image_writer.h"
+#endif
+
+#include <platform/CHIPDeviceLayer.h>
+
+#include <zephyr/drivers/flash.h>
+#if defined(CONFIG_SETTINGS_NVS)
+#include <zephyr/fs/nvs.h>
+#elif defined(CONFIG_SETTINGS_ZMS)
+#include <zephyr/fs/zms.h>
+#endif
+#include <zephyr/logging/log.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/util.h>
+
+#include <errno.h>
+#include <stdlib.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+K_THREAD_STACK_DEFINE(sFlashMaintenanceStack, CONFIG_APP_FLASH_MAINTENANCE_STACK_SIZE);
+
+namespace {
+
+uint32_t ElapsedUs(uint32_t startCycles)
+{
+	return k_cyc_to_us_floor32(k_cycle_get_32() - startCycles);
+}
+
+#ifdef CONFIG_APP_FLASH_MAINTENANCE_SETTINGS
+/*
+ * Moves the settings storage to the next sector when the current one is almost full. The Matter stack writes the
+ * settings on its own thread, so otherwise the garbage collection would stall the event loop in one of its writes.
+ */
+class SettingsCompactionJob : public FlashMaintenance::Job {
+public:
+	/* Returns whether the current sector is almost full. */
+	bool IsDue()
+	{
+		void *storage = nullptr;
+		ssize_t freeSpace;
+
+		if (settings_storage_get(&storage) != 0 || storage == nullptr) {
+			return false;
+		}
+
+#if defined(CONFIG_SETTINGS_NVS)
+		freeSpace = nvs_sector_max_data_size(static_cast<struct nvs_fs *>(storage));
+#else
+		freeSpace = zms_active_sector_free_space(static_cast<struct zms_fs *>(storage));
+#endif
+
+		return freeSpace >= 0 && freeSpace < CONFIG_APP_FLASH_MAINTENANCE_SETTINGS_THRESHOLD;
+	}
+
+	int Step() override
+	{
+		void *storage = nullptr;
+		int err = settings_storage_get(&storage);
+
+		if (err || storage == nullptr) {
+			return err ? err : -ENOTSUP;
+		}
+
+#if defined(CONFIG_SETTINGS_NVS)
+		return nvs_sector_use_next(static_cast<struct nvs_fs *>(storage));
+#else
+		return zms_sector_use_next(static_cast<struct zms_fs *>(storage));
+#endif
+	}
+};
+
+SettingsCompactionJob sSettingsCompactionJob;
+#endif /* CONFIG_APP_FLASH_MAINTENANCE_SETTINGS */
+
+} /* namespace */
+
+void FlashMaintenance::EraseJob::Init(uint8_t areaId, size_t offset, size_t size)
+{
+	mAreaId = areaId;
+	mOffset = offset;
+	mEnd = offset + size;
+}
+
+int FlashMaintenance::EraseJob::Step()
+{
+	struct flash_pages_info info;
+	int err;
+
+	if (mArea == nullptr) {
+		err = flash_area_open(mAreaId, &mArea);
+		if (err) {
+			mArea = nullptr;
+			return err;
+		}
+	}
+
+	err = flash_get_page_info_by_offs(flash_area_get_device(mArea), mArea->fa_off + mOffset, &info);
+	if (!err) {
+		/* Erase the whole page containing the offset, the range is expected to be page aligned. */
+		err = flash_area_erase(mArea, info.start_offset - mArea->fa_off, info.size);
+		mOffset = info.start_offset - mArea->fa_off + info.size;
+	}
+
+	if (err || mOffset >= mEnd) {
+		flash_area_close(mArea);
+		mArea = nullptr;
+		return err;
+	}
+
+	return 1;
+}
+
+int FlashMaintenance::Init()
+{
+	k_sem_init(&mWork, 0, 1);
+	k_thread_create(&mThread, sFlashMaintenanceStack, K_THREAD_STACK_SIZEOF(sFlashMaintenanceStack), ThreadMain,
+			this, nullptr, nullptr, K_PRIO_PREEMPT(CONFIG_APP_FLASH_MAINTENANCE_THREAD_PRIORITY), 0,
+			K_NO_WAIT);
+	k_thread_name_set(&mThread, "flash_maint");
+
+	return 0;
+}
+
+int FlashMaintenance::Submit(Job &job, Priority priority)
+{
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+	Job **position = &mQueue;
+
+	if (job.mQueued) {
+		k_spin_unlock(&mLock, key);
+		return -EALREADY;
+	}
+
+	while (*position != nullptr && (*position)->mPriority >= priority) {
+		position = &(*position)->mNext;
+	}
+
+	job.mPriority = priority;
+	job.mQueued = true;
+	job.mNext = *position;
+	*position = &job;
+
+	k_spin_unlock(&mLock, key);
+	k_sem_give(&mWork);
+
+	return 0;
+}
+
+int FlashMaintenance::Cancel(Job &job)
+{
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+	int err = 0;
+
+	if (!job.mQueued) {
+		err = -EINVAL;
+	} else if (&job == mCurrent) {
+		err = -EBUSY;
+	} else {
+		Remove(job);
+	}
+
+	k_spin_unlock(&mLock, key);
+
+	return err;
+}
+
+FlashMaintenance::Job *FlashMaintenance::Front()
+{
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+
+	mCurrent = mQueue;
+	k_spin_unlock(&mLock, key);
+
+	return mCurrent;
+}
+
+void FlashMaintenance::Remove(Job &job)
+{
+	for (Job **position = &mQueue; *position != nullptr; position = &(*position)->mNext) {
+		if (*position == &job) {
+			*position = job.mNext;
+			break;
+		}
+	}
+
+	job.mNext = nullptr;
+	job.mQueued = false;
+}
+
+void FlashMaintenance::ThreadMain(void *arg1, void *, void *)
+{
+	static_cast<FlashMaintenance *>(arg1)->Run();
+}
+
+void FlashMaintenance::Run()
+{
+	Job *job;
+
+	while (true) {
+#ifdef CONFIG_APP_FLASH_MAINTENANCE_SETTINGS
+		if (k_sem_take(&mWork, K_MSEC(CONFIG_APP_FLASH_MAINTENANCE_SETTINGS_INTERVAL_MS)) != 0) {
+			/* The settings are not written through the application, so check them while idle. */
+			if (sSettingsCompactionJob.IsDue()) {
+				Submit(sSettingsCompactionJob, Priority::kLow);
+			}
+			continue;
+		}
+#else
+		k_sem_take(&mWork, K_FOREVER);
+#endif
+
+		while ((job = Front()) != nullptr) {
+			uint32_t start = k_cycle_get_32();
+			int result;
+			uint32_t sliceUs;
+
+			/* The previous job is still queued, so it has been overtaken by a job of a higher priority. */
+			if (mLast != nullptr && mLast != job && mLast->mQueued) {
+				mStats.mPreemptions++;
+			}
+
+			result = job->Step();
+			sliceUs = ElapsedUs(start);
+
+			mStats.mSlices++;
+			mStats.mBusyUs += sliceUs;
+			mStats.mMaxSliceUs = MAX(mStats.mMaxSliceUs, sliceUs);
+			mLast = job;
+
+			if (result <= 0) {
+				k_spinlock_key_t key = k_spin_lock(&mLock);
+
+				Remove(*job);
+				mCurrent = nullptr;
+				mLast = nullptr;
+				k_spin_unlock(&mLock, key);
+
+				if (result < 0) {
+					LOG_WRN("Flash maintenance job failed: %d", result);
+					mStats.mFailedJobs++;
+				} else {
+					mStats.mCompletedJobs++;
+				}
+
+				job->OnDone(result);
+			} else {
+				k_spinlock_key_t key = k_spin_lock(&mLock);
+
+				mCurrent = nullptr;
+				k_spin_unlock(&mLock, key);
+			}
+
+			k_sleep(K_MSEC(CONFIG_APP_FLASH_MAINTENANCE_SLICE_GAP_MS));
+		}
+	}
+}
+
+#ifdef CONFIG_SHELL
+namespace {
+
+#if FIXED_PARTITION_EXISTS(mcuboot_secondary)
+constexpr uint32_t kProbeIntervalMs = 5;
+
+/* Measures how late a periodic timer fires on the Matter thread, which is how long the event loop was stalled. */
+struct LoopProbe {
+	static void OnTimer(chip::System::Layer *layer, void *context)
+	{
+		LoopProbe &probe = *static_cast<LoopProbe *>(context);
+		uint32_t elapsedUs = ElapsedUs(probe.mScheduled);
+
+		probe.mMaxDelayUs = MAX(probe.mMaxDelayUs, elapsedUs - MIN(elapsedUs, kProbeIntervalMs * USEC_PER_MSEC));
+		if (probe.mRunning) {
+			probe.Schedule();
+		}
+	}
+
+	void Schedule()
+	{
+		mScheduled = k_cycle_get_32();
+		chip::DeviceLayer::SystemLayer().StartTimer(chip::System::Clock::Milliseconds32(kProbeIntervalMs), OnTimer,
+							    this);
+	}
+
+	void Start()
+	{
+		chip::DeviceLayer::StackLock lock;
+
+		mMaxDelayUs = 0;
+		mRunning = true;
+		Schedule();
+	}
+
+	void Stop()
+	{
+		chip::DeviceLayer::StackLock lock;
+
+		mRunning = false;
+		chip::DeviceLayer::SystemLayer().CancelTimer(OnTimer, this);
+	}
+
+	uint32_t mScheduled;
+	uint32_t mMaxDelayUs;
+	bool mRunning;
+};
+
+struct BenchEraseJob : public FlashMaintenance::EraseJob {
+	void OnDone(int result) override
+	{
+		mResult = result;
+		k_sem_give(&mDone);
+	}
+
+	struct k_sem mDone;
+	int mResult;
+};
+
+BenchEraseJob sBenchJob;
+LoopProbe sProbe;
+
+/* Erases the range on the Matter thread in one go, like storage code running in a cluster callback would. */
+void EraseInline(intptr_t)
+{
+	int result;
+
+	do {
+		result = sBenchJob.Step();
+	} while (result > 0);
+
+	sBenchJob.mResult = result;
+	k_sem_give(&sBenchJob.mDone);
+}
+
+int FlashMaintenanceBenchHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	const uint8_t areaId = FIXED_PARTITION_ID(mcuboot_secondary);
+	size_t size = (argc > 1 ? strtoul(argv[1], nullptr, 10) : 64) * 1024;
+	int64_t start;
+	int64_t inlineMs;
+	int64_t slicedMs;
+	uint32_t inlineDelayUs;
+
+#ifdef CONFIG_APP_OTA_WRITER
+	if (OtaImageWriter::Instance().IsBusy()) {
+		shell_error(shell, "An image is being written");
+		return -EBUSY;
+	}
+#endif
+	if (sBenchJob.IsQueued()) {
+		return -EBUSY;
+	}
+
+	size = MIN(size, static_cast<size_t>(FIXED_PARTITION_SIZE(mcuboot_secondary)));
+	k_sem_init(&sBenchJob.mDone, 0, 1);
+	shell_print(shell, "Erasing %u KiB of the secondary slot", static_cast<unsigned>(size / 1024));
+
+	sBenchJob.Init(areaId, 0, size);
+	sProbe.Start();
+	start = k_uptime_get();
+	chip::DeviceLayer::PlatformMgr().ScheduleWork(EraseInline);
+	k_sem_take(&sBenchJob.mDone, K_FOREVER);
+	inlineMs = k_uptime_get() - start;
+	/* Let the probe fire once more to account for the stall. */
+	k_sleep(K_MSEC(2 * kProbeIntervalMs));
+	sProbe.Stop();
+	inlineDelayUs = sProbe.mMaxDelayUs;
+
+	if (sBenchJob.mResult < 0) {
+		shell_error(shell, "Erase failed: %d", sBenchJob.mResult);
+		return sBenchJob.mResult;
+	}
+
+	sBenchJob.Init(areaId, 0, size);
+	sProbe.Start();
+	start = k_uptime_get();
+	FlashMaintenance::Instance().Submit(sBenchJob, FlashMaintenance::Priority::kNormal);
+	k_sem_take(&sBenchJob.mDone, K_FOREVER);
+	slicedMs = k_uptime_get() - start;
+	k_sleep(K_MSEC(2 * kProbeIntervalMs));
+	sProbe.Stop();
+
+	if (sBenchJob.mResult < 0) {
+		shell_error(shell, "Erase failed: %d", sBenchJob.mResult);
+		return sBenchJob.mResult;
+	}
+
+	shell_print(shell, "on the Matter thread: %lld ms, event loop stalled up to %u us", inlineMs, inlineDelayUs);
+	shell_print(shell, "sliced:               %lld ms, event loop stalled up to %u us", slicedMs,
+		    sProbe.mMaxDelayUs);
+	shell_warn(shell, "The secondary slot has been erased");
+
+	return 0;
+}
+#endif /* FIXED_PARTITION_EXISTS(mcuboot_secondary) */
+
+int FlashMaintenanceStatsHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	const FlashMaintenance::Stats &stats = FlashMaintenance::Instance().GetStats();
+
+	shell_print(shell, "jobs: completed %u, failed %u, preempted %u", stats.mCompletedJobs, stats.mFailedJobs,
+		    stats.mPreemptions);
+	shell_print(shell, "slices: %u, busy %u ms, max slice %u us", stats.mSlices, stats.mBusyUs / USEC_PER_MSEC,
+		    stats.mMaxSliceUs);
+
+	return 0;
+}
+
+int FlashMaintenanceResetHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	FlashMaintenance::Instance().ResetStats();
+	return 0;
+}
+
+} /* namespace */
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_flash_maintenance,
+			       SHELL_CMD_ARG(stats, NULL, "Print flash maintenance statistics",
+					     FlashMaintenanceStatsHandler, 1, 0),
+			       SHELL_CMD_ARG(reset, NULL, "Reset flash maintenance statistics",
+					     FlashMaintenanceResetHandler, 1, 0),
+#if FIXED_PARTITION_EXISTS(mcuboot_secondary)
+			       SHELL_CMD_ARG(bench, NULL,
+					     "Compare the event loop stall of erasing on the Matter thread and in slices "
+					     "(erases the secondary slot). Usage: bench [KiB]",
+					     FlashMaintenanceBenchHandler, 1, 1),
+#endif
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((app), flash_maint, &sub_flash_maintenance, "Flash maintenance service", NULL, 1, 0);
+#endif /* CONFIG_SHELL */
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/*
+ * Runs flash erases and storage compaction on a low priority thread, so they are done while the device is otherwise
+ * idle and never on the Matter thread.
+ *
+ * The work is split into jobs, which are queued by priority and performed in slices of at most one flash operation
+ * (usually a single page erase). Between slices the thread yields for CONFIG_APP_FLASH_MAINTENANCE_SLICE_GAP_MS, so
+ * other threads waiting for the flash get it after one slice at most, and a job of a higher priority submitted in
+ * the meantime takes over before the next slice of the current one. Compacting an NVS or ZMS storage takes one
+ * slice per sector, as both copy the records left in the reclaimed sector and erase it in a single call.
+ *
+ * With CONFIG_APP_FLASH_MAINTENANCE_SETTINGS, the thread also compacts the settings storage ahead of time, so the
+ * settings writes of the Matter stack do not run its garbage collection on the Matter thread.
+ */
+class FlashMaintenance {
+public:
+	enum class Priority : uint8_t { kLow, kNormal, kHigh };
+
+	class Job {
+	public:
+		virtual ~Job() = default;
+
+		/* Performs one slice of the job. Returns a positive value if there is more to do. */
+		virtual int Step() = 0;
+		/* Called on the maintenance thread once the job is finished, with 0 or a negative error code. */
+		virtual void OnDone(int result) {}
+
+		bool IsQueued() const { return mQueued; }
+
+	private:
+		friend class FlashMaintenance;
+
+		Job *mNext{ nullptr };
+		Priority mPriority{ Priority::kNormal };
+		bool mQueued{ false };
+	};
+
+	/* Erases a range of a flash area page by page. */
+	class EraseJob : public Job {
+	public:
+		void Init(uint8_t areaId, size_t offset, size_t size);
+		int Step() override;
+
+	private:
+		const struct flash_area *mArea{ nullptr };
+		uint8_t mAreaId{ 0 };
+		size_t mOffset{ 0 };
+		size_t mEnd{ 0 };
+	};
+
+	struct Stats {
+		uint32_t mSlices;
+		uint32_t mBusyUs;
+		uint32_t mMaxSliceUs;
+		uint32_t mCompletedJobs;
+		uint32_t mFailedJobs;
+		uint32_t mPreemptions;
+	};
+
+	static FlashMaintenance &Instance()
+	{
+		static FlashMaintenance sFlashMaintenance;
+		return sFlashMaintenance;
+	}
+
+	int Init();
+	/* Queues the job behind the jobs of the same or higher priority. */
+	int Submit(Job &job, Priority priority);
+	/* Removes a queued job. A job whose slice is being performed cannot be cancelled. */
+	int Cancel(Job &job);
+
+	const Stats &GetStats() const { return mStats; }
+	void ResetStats() { memset(&mStats, 0, sizeof(mStats)); }
+
+private:
+	static void ThreadMain(void *arg1, void *arg2, void *arg3);
+
+	void Run();
+	Job *Front();
+	void Remove(Job &job);
+
+	Job *mQueue{ nullptr };
+	Job *mCurrent{ nullptr };
+	Job *mLast{ nullptr };
+	struct k_spinlock mLock;
+	struct k_sem mWork;
+	struct k_thread mThread;
+	Stats mStats{};
+};
@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "heap_stats.h"
+
+#include <platform/CHIPDeviceLayer.h>
+#include <platform/Zephyr/SysHeapMalloc.h>
+#include <system/SystemConfig.h>
+#include <system/SystemStats.h>
+
+#include <mbedtls/platform.h>
+#ifdef CONFIG_MBEDTLS_ENABLE_HEAP
+#include <mbedtls/memory_buffer_alloc.h>
+#endif
+
+#include <zephyr/init.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/sys/util.h>
+
+#include <string.h>
+#ifdef CONFIG_NEWLIB_LIBC
+#include <reent.h>
+#endif
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+namespace Malloc = ::chip::DeviceLayer::Malloc;
+
+#if !CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+#error "Heap statistics require CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS"
+#endif
+
+#ifdef CONFIG_CHIP_MALLOC_SYS_HEAP_OVERRIDE
+#error "Heap statistics wrap the allocation functions in place of CONFIG_CHIP_MALLOC_SYS_HEAP_OVERRIDE"
+#endif
+
+/*
+ * The Zephyr mbedTLS heap installs its own allocator, whose usage is kept by the mbedTLS buffer allocator with
+ * MBEDTLS_MEMORY_DEBUG. Without it, the crypto allocations are served by the system heap through the allocator below.
+ */
+#if defined(MBEDTLS_PLATFORM_MEMORY) && !defined(CONFIG_MBEDTLS_ENABLE_HEAP)
+#define APP_HEAP_STATS_CRYPTO 1
+#else
+#define APP_HEAP_STATS_CRYPTO 0
+#endif
+
+#if defined(CONFIG_MBEDTLS_ENABLE_HEAP) && defined(MBEDTLS_MEMORY_BUFFER_ALLOC_C) && defined(MBEDTLS_MEMORY_DEBUG)
+#define APP_HEAP_STATS_MBEDTLS_HEAP 1
+#else
+#define APP_HEAP_STATS_MBEDTLS_HEAP 0
+#endif
+
+namespace {
+
+constexpr const char *kHeapNames[HeapStats::kHeapCount] = { "system", "crypto" };
+
+void *CheckAlloc(void *block, size_t size, void *caller)
+{
+	if (!block && size > 0) {
+		HeapStats::Instance().OnAllocFailed(HeapStats::kSystemHeap, size, caller);
+	}
+
+	return block;
+}
+
+#if APP_HEAP_STATS_CRYPTO
+/* Size of the crypto allocation, stored in front of it to account for it when freed. */
+struct alignas(8) CryptoHeader {
+	size_t mSize;
+};
+
+void *CryptoCalloc(size_t count, size_t size)
+{
+	size_t bytes;
+
+	if (size_mul_overflow(count, size, &bytes) || bytes > SIZE_MAX - sizeof(CryptoHeader)) {
+		HeapStats::Instance().OnAllocFailed(HeapStats::kCryptoHeap, SIZE_MAX, __builtin_return_address(0));
+		return nullptr;
+	}
+
+	CryptoHeader *header = static_cast<CryptoHeader *>(Malloc::Calloc(1, sizeof(CryptoHeader) + bytes));
+
+	if (!header) {
+		HeapStats::Instance().OnAllocFailed(HeapStats::kCryptoHeap, bytes, __builtin_return_address(0));
+		return nullptr;
+	}
+
+	header->mSize = bytes;
+	HeapStats::Instance().OnCryptoAlloc(bytes);
+
+	return header + 1;
+}
+
+void CryptoFree(void *block)
+{
+	if (!block) {
+		return;
+	}
+
+	CryptoHeader *header = static_cast<CryptoHeader *>(block) - 1;
+
+	HeapStats::Instance().OnCryptoFree(header->mSize);
+	Malloc::Free(header);
+}
+
+/* Must run before the first mbedTLS or PSA allocation, the blocks allocated before would be freed with the header. */
+int InstallCryptoAllocator()
+{
+	return mbedtls_platform_set_calloc_free(CryptoCalloc, CryptoFree);
+}
+
+SYS_INIT(InstallCryptoAllocator, PRE_KERNEL_1, 0);
+#endif /* APP_HEAP_STATS_CRYPTO */
+
+} /* namespace */
+
+/* Linked in with --wrap, see CMakeLists.txt. */
+extern "C" {
+
+void *__wrap_malloc(size_t size)
+{
+	return CheckAlloc(Malloc::Malloc(size), size, __builtin_return_address(0));
+}
+
+void *__wrap_calloc(size_t count, size_t size)
+{
+	return CheckAlloc(Malloc::Calloc(count, size), count * size, __builtin_return_address(0));
+}
+
+void *__wrap_realloc(void *block, size_t size)
+{
+	return CheckAlloc(Malloc::Realloc(block, size), size, __builtin_return_address(0));
+}
+
+void __wrap_free(void *block)
+{
+	Malloc::Free(block);
+}
+
+#ifdef CONFIG_MBEDTLS_ENABLE_HEAP
+void *__real_mbedtls_calloc(size_t count, size_t size);
+
+void *__wrap_mbedtls_calloc(size_t count, size_t size)
+{
+	void *block = __real_mbedtls_calloc(count, size);
+	size_t bytes;
+
+	if (!block && count > 0 && size > 0) {
+		HeapStats::Instance().OnAllocFailed(HeapStats::kCryptoHeap,
+						    size_mul_overflow(count, size, &bytes) ? SIZE_MAX : bytes,
+						    __builtin_return_address(0));
+	}
+
+	return block;
+}
+#endif /* CONFIG_MBEDTLS_ENABLE_HEAP */
+
+#ifdef CONFIG_NEWLIB_LIBC
+void *__wrap__malloc_r(struct _reent *, size_t size)
+{
+	return CheckAlloc(Malloc::Malloc(size), size, __builtin_return_address(0));
+}
+
+void *__wrap__calloc_r(struct _reent *, size_t count, size_t size)
+{
+	return CheckAlloc(Malloc::Calloc(count, size), count * size, __builtin_return_address(0));
+}
+
+void *__wrap__realloc_r(struct _reent *, void *block, size_t size)
+{
+	return CheckAlloc(Malloc::Realloc(block, size), size, __builtin_return_address(0));
+}
+
+void __wrap__free_r(struct _reent *, void *block)
+{
+	Malloc::Free(block);
+}
+#endif /* CONFIG_NEWLIB_LIBC */
+
+} /* extern "C" */
+
+void HeapStats::OnAllocFailed(Heap heap, size_t size, void *caller)
+{
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+
+	mFailures[heap]++;
+	mLastFailure = { heap, static_cast<uint32_t>(MIN(size, UINT32_MAX)), caller };
+
+	k_spin_unlock(&mLock, key);
+
+#ifdef CONFIG_APP_HEAP_STATS_LOG_FAILURES
+	LOG_WRN("%s heap: allocation of %zu B failed, called from %p", kHeapNames[heap], size, caller);
+#endif
+}
+
+void HeapStats::OnCryptoAlloc(size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+
+	mCryptoUsed += size;
+	mCryptoPeak = MAX(mCryptoPeak, mCryptoUsed);
+
+	k_spin_unlock(&mLock, key);
+}
+
+void HeapStats::OnCryptoFree(size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+
+	mCryptoUsed -= size;
+
+	k_spin_unlock(&mLock, key);
+}
+
+void HeapStats::Reset()
+{
+	System::Stats::count_t *inUse = System::Stats::GetResourcesInUse();
+	System::Stats::count_t *peaks = System::Stats::GetHighWatermarks();
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+
+	memset(mFailures, 0, sizeof(mFailures));
+	mLastFailure = {};
+	mCryptoPeak = mCryptoUsed;
+
+	k_spin_unlock(&mLock, key);
+
+	Malloc::ResetMaxStats();
+#if APP_HEAP_STATS_MBEDTLS_HEAP
+	mbedtls_memory_buffer_alloc_max_reset();
+#endif
+	peaks[System::Stats::kSystemLayer_NumPacketBufs] = inUse[System::Stats::kSystemLayer_NumPacketBufs];
+}
+
+HeapStats::Usage HeapStats::Get(Heap heap)
+{
+	Usage usage{};
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+
+	usage.mFailures = mFailures[heap];
+
+	if (heap == kCryptoHeap) {
+		usage.mTracked = APP_HEAP_STATS_CRYPTO;
+		usage.mUsed = mCryptoUsed;
+		usage.mPeak = mCryptoPeak;
+	}
+
+	k_spin_unlock(&mLock, key);
+
+#if APP_HEAP_STATS_MBEDTLS_HEAP
+	if (heap == kCryptoHeap) {
+		size_t used, blocks, peak, peakBlocks;
+
+		mbedtls_memory_buffer_alloc_cur_get(&used, &blocks);
+		mbedtls_memory_buffer_alloc_max_get(&peak, &peakBlocks);
+		usage.mTracked = true;
+		usage.mUsed = used;
+		usage.mPeak = peak;
+	}
+#endif
+
+	if (heap == kSystemHeap) {
+		Malloc::Stats stats{};
+
+		usage.mTracked = Malloc::GetStats(stats) == CHIP_NO_ERROR;
+		usage.mUsed = stats.used;
+		usage.mPeak = stats.maxUsed;
+	}
+
+	return usage;
+}
+
+HeapStats::PacketBuffers HeapStats::GetPacketBuffers()
+{
+	return { System::Stats::GetResourcesInUse()[System::Stats::kSystemLayer_NumPacketBufs],
+		 System::Stats::GetHighWatermarks()[System::Stats::kSystemLayer_NumPacketBufs] };
+}
+
+#ifdef CONFIG_SHELL
+void HeapStats::Print(const struct shell *shell)
+{
+	shell_print(shell, "%-15s %-8s %-8s %-8s", "heap", "used", "peak", "failures");
+
+	for (size_t i = 0; i < kHeapCount; i++) {
+		Usage usage = Get(static_cast<Heap>(i));
+
+		if (!usage.mTracked) {
+			shell_print(shell, "%-15s not tracked", kHeapNames[i]);
+			continue;
+		}
+
+		shell_print(shell, "%-15s %-8u %-8u %-8u", kHeapNames[i], usage.mUsed, usage.mPeak, usage.mFailures);
+	}
+
+	PacketBuffers buffers = GetPacketBuffers();
+
+	shell_print(shell, "%-15s %-8u %-8u (allocated from the system heap)", "packet buffers", buffers.mInUse,
+		    buffers.mPeak);
+#ifdef CONFIG_MBEDTLS_ENABLE_HEAP
+	shell_print(shell, "crypto allocations served by the mbedTLS heap of %u B", CONFIG_MBEDTLS_HEAP_SIZE);
+#endif
+
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+	Failure failure = mLastFailure;
+
+	k_spin_unlock(&mLock, key);
+
+	if (failure.mCaller) {
+		shell_print(shell, "last failure: %s heap, %u B, called from %p", kHeapNames[failure.mHeap],
+			    failure.mSize, failure.mCaller);
+	}
+}
+
+static int HeapStatsShowHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	HeapStats::Instance().Print(shell);
+	return 0;
+}
+
+static int HeapStatsResetHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::StackLock lock;
+
+	HeapStats::Instance().Reset();
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_heap_stats,
+			       SHELL_CMD_ARG(show, NULL, "Print the heap and packet buffer usage and failed allocations",
+					     HeapStatsShowHandler, 1, 0),
+			       SHELL_CMD_ARG(reset, NULL, "Reset the peak usage and the failure counters",
+					     HeapStatsResetHandler, 1, 0),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((app), heap, &sub_heap_stats, "Heap usage", NULL, 1, 0);
+#endif /* CONFIG_SHELL */
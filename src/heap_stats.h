@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct shell;
+
+/*
+ * Usage of the memory that the Matter stack allocates at run time: the system heap serving malloc (the Matter sys
+ * heap), the mbedTLS and PSA crypto allocations, served by the mbedTLS heap with CONFIG_MBEDTLS_ENABLE_HEAP and by the
+ * system heap otherwise, and the Matter packet buffers, which are allocated from the system heap on this platform.
+ * The allocation functions are wrapped by this module in place of CONFIG_CHIP_MALLOC_SYS_HEAP_OVERRIDE to count the
+ * failed allocations, which otherwise only show up as dropped reports or failed handshakes. The usage is printed
+ * with the "app heap show" shell command and exposed in the Memory Diagnostics cluster on endpoint 0.
+ */
+class HeapStats {
+public:
+	enum Heap : uint8_t { kSystemHeap, kCryptoHeap, kHeapCount };
+
+	struct Usage {
+		/* False if the allocations of the heap cannot be tracked in this build. */
+		bool mTracked;
+		uint32_t mUsed;
+		uint32_t mPeak;
+		uint32_t mFailures;
+	};
+
+	struct PacketBuffers {
+		uint32_t mInUse;
+		uint32_t mPeak;
+	};
+
+	static HeapStats &Instance()
+	{
+		static HeapStats sHeapStats;
+		return sHeapStats;
+	}
+
+	void Reset();
+	Usage Get(Heap heap);
+	PacketBuffers GetPacketBuffers();
+	void Print(const struct shell *shell);
+
+	/* Called by the allocation wrappers from any thread. */
+	void OnAllocFailed(Heap heap, size_t size, void *caller);
+	void OnCryptoAlloc(size_t size);
+	void OnCryptoFree(size_t size);
+
+private:
+	struct Failure {
+		Heap mHeap;
+		uint32_t mSize;
+		void *mCaller;
+	};
+
+	struct k_spinlock mLock;
+	Failure mLastFailure{};
+	uint32_t mFailures[kHeapCount]{};
+	uint32_t mCryptoUsed{ 0 };
+	uint32_t mCryptoPeak{ 0 };
+};
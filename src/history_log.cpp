@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "history_log.h"
+#include "app_storage.h"
+
+#ifdef CONFIG_APP_TIME_SYNC
+#include "time_sync.h"
+#endif
+
+#include <zephyr/logging/log.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/util.h>
+
+#include <errno.h>
+#include <string.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+namespace {
+
+constexpr uint32_t kBlockSamples = CONFIG_APP_HISTORY_BLOCK_SAMPLES;
+constexpr size_t kBlockHeaderSize = sizeof(uint32_t);
+
+} /* namespace */
+
+uint32_t HistoryLog::Timestamp()
+{
+#ifdef CONFIG_APP_TIME_SYNC
+	return TimeSync::Instance().Timestamp();
+#else
+	return static_cast<uint32_t>(k_uptime_get() / MSEC_PER_SEC);
+#endif
+}
+
+int HistoryLog::Init()
+{
+	AppStorage &storage = AppStorage::Instance();
+	bool found = false;
+	uint32_t last = 0;
+
+	k_mutex_init(&mLock);
+
+	/* Each record starts with the sequence number of its first sample, the newest one tells where to continue. */
+	for (uint32_t index = 0; index < CONFIG_APP_HISTORY_BLOCKS; index++) {
+		uint32_t firstSeq;
+		ssize_t size = storage.Read(kBlockIdBase + index, &firstSeq, sizeof(firstSeq));
+
+		if (size < static_cast<ssize_t>(sizeof(firstSeq)) || firstSeq % kBlockSamples != 0 ||
+		    (firstSeq / kBlockSamples) % CONFIG_APP_HISTORY_BLOCKS != index) {
+			continue;
+		}
+
+		if (!found || firstSeq > last) {
+			last = firstSeq;
+			found = true;
+		}
+	}
+
+	mNextSeq = found ? last + kBlockSamples : 0;
+	mBlock.mFirstSeq = mNextSeq;
+	mInitialized = true;
+
+	LOG_INF("History log: %u samples stored", static_cast<unsigned>(mNextSeq - FirstBlock() * kBlockSamples));
+
+	return 0;
+}
+
+uint32_t HistoryLog::FirstBlock() const
+{
+	uint32_t current = mNextSeq / kBlockSamples;
+
+	return current > CONFIG_APP_HISTORY_BLOCKS ? current - CONFIG_APP_HISTORY_BLOCKS : 0;
+}
+
+void HistoryLog::Append(int16_t temperature, uint16_t humidity)
+{
+	if (!mInitialized) {
+		return;
+	}
+
+	k_mutex_lock(&mLock, K_FOREVER);
+
+	Sample &sample = mBlock.mSamples[mNextSeq % kBlockSamples];
+
+	sample.mTimestamp = Timestamp();
+	sample.mTemperature = temperature;
+	sample.mHumidity = humidity;
+	mNextSeq++;
+
+	if (mNextSeq % kBlockSamples == 0) {
+		Flush();
+	}
+
+	k_mutex_unlock(&mLock);
+}
+
+void HistoryLog::Flush()
+{
+	uint32_t block = mBlock.mFirstSeq / kBlockSamples;
+	ssize_t written = AppStorage::Instance().Write(BlockId(block), &mBlock, sizeof(mBlock));
+
+	if (written < 0) {
+		LOG_ERR("History log: failed to write block %u: %d", block, static_cast<int>(written));
+		mWriteErrors++;
+	}
+
+	mBlock.mFirstSeq = mNextSeq;
+	AppStorage::Instance().ScheduleCompaction();
+}
+
+void HistoryLog::GetRange(uint32_t &first, uint32_t &next)
+{
+	k_mutex_lock(&mLock, K_FOREVER);
+	first = FirstBlock() * kBlockSamples;
+	next = mNextSeq;
+	k_mutex_unlock(&mLock);
+}
+
+uint32_t HistoryLog::Find(uint32_t timestamp)
+{
+	AppStorage &storage = AppStorage::Instance();
+	uint32_t result;
+
+	k_mutex_lock(&mLock, K_FOREVER);
+
+	result = FirstBlock() * kBlockSamples;
+
+	/*
+	 * Only the first sample of each block is read, the rest is filtered out by Read(). A block is written within
+	 * a single boot, so its first sample is stamped with the seconds since boot if any of them is. Such blocks sit
+	 * between blocks stamped since the Matter epoch, which keep growing, and are not compared.
+	 */
+	for (uint32_t block = FirstBlock(); IsEpochTimestamp(timestamp) && block < mNextSeq / kBlockSamples; block++) {
+		uint8_t head[kBlockHeaderSize + sizeof(Sample)];
+		Sample first;
+
+		if (storage.Read(BlockId(block), head, sizeof(head)) < static_cast<ssize_t>(sizeof(head))) {
+			continue;
+		}
+
+		memcpy(&first, head + kBlockHeaderSize, sizeof(first));
+		if (!IsEpochTimestamp(first.mTimestamp)) {
+			continue;
+		}
+
+		if (first.mTimestamp > timestamp) {
+			break;
+		}
+
+		result = block * kBlockSamples;
+	}
+
+	k_mutex_unlock(&mLock);
+
+	return result;
+}
+
+ssize_t HistoryLog::Read(uint32_t &seq, uint32_t start, uint32_t end, uint8_t *buffer, size_t size)
+{
+	size_t copied = 0;
+
+	if (!mInitialized) {
+		return -EAGAIN;
+	}
+
+	if (size < sizeof(Block)) {
+		return -ENOMEM;
+	}
+
+	k_mutex_lock(&mLock, K_FOREVER);
+
+	seq = MAX(seq, FirstBlock() * kBlockSamples);
+
+	while (seq < mNextSeq && copied + sizeof(Block) <= size) {
+		uint32_t block = seq / kBlockSamples;
+		uint32_t count = MIN(mNextSeq - block * kBlockSamples, kBlockSamples);
+		const Sample *samples;
+		bool ended = false;
+
+		if (block == mBlock.mFirstSeq / kBlockSamples) {
+			samples = mBlock.mSamples;
+		} else {
+			/* Read the record straight into the free part of the buffer, it is compacted in place below. */
+			ssize_t read = AppStorage::Instance().Read(BlockId(block), buffer + copied, sizeof(Block));
+
+			if (read != sizeof(Block) ||
+			    reinterpret_cast<const Block *>(buffer + copied)->mFirstSeq != block * kBlockSamples) {
+				/* Missing or overwritten in the meantime, skip it. */
+				seq = (block + 1) * kBlockSamples;
+				continue;
+			}
+
+			samples = reinterpret_cast<const Block *>(buffer + copied)->mSamples;
+		}
+
+		/* The samples kept never overtake the sample being examined, so they can be moved within the buffer. */
+		for (uint32_t i = seq % kBlockSamples; i < count; i++) {
+			Sample sample;
+
+			memcpy(&sample, &samples[i], sizeof(sample));
+
+			/* Only the timestamps since the Matter epoch grow with the sequence numbers. */
+			if (IsEpochTimestamp(sample.mTimestamp) && IsEpochTimestamp(end) && sample.mTimestamp > end) {
+				ended = true;
+				break;
+			}
+
+			if (sample.mTimestamp >= start) {
+				memcpy(buffer + copied, &sample, sizeof(sample));
+				copied += sizeof(sample);
+			}
+		}
+
+		seq = ended ? mNextSeq : block * kBlockSamples + count;
+	}
+
+	k_mutex_unlock(&mLock);
+
+	return copied;
+}
+
+#ifdef CONFIG_SHELL
+void HistoryLog::Print(const struct shell *shell)
+{
+	uint32_t first;
+	uint32_t next;
+
+	GetRange(first, next);
+	shell_print(shell, "samples: %u..%u (%u stored, capacity %u)", first, next, next - first,
+		    CONFIG_APP_HISTORY_BLOCKS * kBlockSamples);
+	shell_print(shell, "write errors: %u", mWriteErrors);
+}
+
+static int HistoryShowHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	HistoryLog::Instance().Print(shell);
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_history,
+			       SHELL_CMD_ARG(show, NULL, "Print the state of the history log", HistoryShowHandler, 1, 0),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((app), history, &sub_history, "Measurement history", NULL, 1, 0);
+#endif /* CONFIG_SHELL */
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+#include <zephyr/toolchain.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct shell;
+
+/*
+ * Log of the measured values kept in the application record storage.
+ *
+ * Samples are numbered with a sequence number increasing over the lifetime of the log. They are collected in a RAM
+ * block of CONFIG_APP_HISTORY_BLOCK_SAMPLES samples, which is written to the storage as one record once full. The
+ * log keeps the last CONFIG_APP_HISTORY_BLOCKS blocks, the oldest block being overwritten by the newest one. The
+ * samples of the RAM block are lost on reset.
+ */
+class HistoryLog {
+public:
+	struct __packed Sample {
+		/* Seconds, see Timestamp(). */
+		uint32_t mTimestamp;
+		/* Units of the MeasuredValue attributes: 0.01 °C and 0.01 %. */
+		int16_t mTemperature;
+		uint16_t mHumidity;
+	};
+
+	/*
+	 * Timestamps below this value, 2020-01-01 in the Matter epoch, are seconds since boot. They restart at every
+	 * boot, so unlike the timestamps since the Matter epoch they do not grow with the sequence numbers.
+	 */
+	static constexpr uint32_t kMinEpochTimestamp = 631152000;
+
+	static bool IsEpochTimestamp(uint32_t timestamp) { return timestamp >= kMinEpochTimestamp; }
+
+	static HistoryLog &Instance()
+	{
+		static HistoryLog sHistoryLog;
+		return sHistoryLog;
+	}
+
+	/*
+	 * Seconds since the Matter epoch (2000-01-01) once the time is synchronized with CONFIG_APP_TIME_SYNC, seconds
+	 * since boot otherwise.
+	 */
+	static uint32_t Timestamp();
+
+	/* Must be called after the application record storage is mounted. */
+	int Init();
+	void Append(int16_t temperature, uint16_t humidity);
+
+	/* Returns the sequence numbers of the oldest sample stored and of the next sample to be appended. */
+	void GetRange(uint32_t &first, uint32_t &next);
+	/*
+	 * Returns a sequence number from which a read returns all the samples not older than the timestamp. Samples
+	 * stamped with the seconds since boot are not ordered in time, a timestamp below kMinEpochTimestamp returns the
+	 * oldest sample.
+	 */
+	uint32_t Find(uint32_t timestamp);
+	/*
+	 * Copies the samples starting with sequence number seq, with timestamps in the [start, end] range, to the
+	 * buffer. The stored blocks are read directly into the buffer, so it must fit at least one whole block. Returns
+	 * the number of bytes copied and advances seq past the samples examined.
+	 */
+	ssize_t Read(uint32_t &seq, uint32_t start, uint32_t end, uint8_t *buffer, size_t size);
+
+	/* Size of the buffer needed to read a block. */
+	static constexpr size_t BlockSize() { return sizeof(Block); }
+
+	void Print(const struct shell *shell);
+
+private:
+	struct __packed Block {
+		uint32_t mFirstSeq;
+		Sample mSamples[CONFIG_APP_HISTORY_BLOCK_SAMPLES];
+	};
+
+	static constexpr uint32_t kBlockIdBase = 0x100;
+
+	static uint32_t BlockId(uint32_t block) { return kBlockIdBase + block % CONFIG_APP_HISTORY_BLOCKS; }
+
+	uint32_t FirstBlock() const;
+	void Flush();
+
+	Block mBlock{};
+	uint32_t mNextSeq{ 0 };
+	bool mInitialized{ false };
+	uint32_t mWriteErrors{ 0 };
+	struct k_mutex mLock;
+};
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "history_smp.h"
+#include "history_log.h"
+
+#include <zcbor_common.h>
+#include <zcbor_decode.h>
+#include <zcbor_encode.h>
+#include <zephyr/mgmt/mcumgr/mgmt/mgmt.h>
+#include <zephyr/mgmt/mcumgr/smp/smp.h>
+#include <zephyr/mgmt/mcumgr/util/zcbor_bulk.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+namespace {
+
+/* Space left in the response after the data for the "off" key and value. */
+constexpr size_t kTrailerSize = 16;
+
+int HistoryInfo(struct smp_streamer *ctxt)
+{
+	zcbor_state_t *zse = ctxt->writer->zs;
+	uint32_t first;
+	uint32_t next;
+
+	HistoryLog::Instance().GetRange(first, next);
+
+	if (!(zcbor_tstr_put_lit(zse, "first") && zcbor_uint32_put(zse, first) && zcbor_tstr_put_lit(zse, "next") &&
+	      zcbor_uint32_put(zse, next) && zcbor_tstr_put_lit(zse, "capacity") &&
+	      zcbor_uint32_put(zse, CONFIG_APP_HISTORY_BLOCKS * CONFIG_APP_HISTORY_BLOCK_SAMPLES) &&
+	      zcbor_tstr_put_lit(zse, "size") && zcbor_uint32_put(zse, sizeof(HistoryLog::Sample)))) {
+		return MGMT_ERR_EMSGSIZE;
+	}
+
+	return MGMT_ERR_EOK;
+}
+
+int HistoryRead(struct smp_streamer *ctxt)
+{
+	zcbor_state_t *zse = ctxt->writer->zs;
+	zcbor_state_t *zsd = ctxt->reader->zs;
+	uint32_t start = 0;
+	uint32_t end = UINT32_MAX;
+	uint32_t off = UINT32_MAX;
+	uint32_t first;
+	uint32_t next;
+	size_t available;
+	size_t decoded;
+	ssize_t copied;
+
+	struct zcbor_map_decode_key_val params[] = {
+		ZCBOR_MAP_DECODE_KEY_DECODER("start", zcbor_uint32_decode, &start),
+		ZCBOR_MAP_DECODE_KEY_DECODER("end", zcbor_uint32_decode, &end),
+		ZCBOR_MAP_DECODE_KEY_DECODER("off", zcbor_uint32_decode, &off),
+	};
+
+	if (zcbor_map_decode_bulk(zsd, params, ARRAY_SIZE(params), &decoded) != 0 || start > end) {
+		return MGMT_ERR_EINVAL;
+	}
+
+	if (off == UINT32_MAX) {
+		off = HistoryLog::Instance().Find(start);
+	}
+
+	/*
+	 * The samples are read from the storage directly into the response buffer, inside a byte string whose header
+	 * is fixed up once its length is known.
+	 */
+	if (!zcbor_tstr_put_lit(zse, "data") || !zcbor_bstr_start_encode(zse)) {
+		return MGMT_ERR_EMSGSIZE;
+	}
+
+	available = static_cast<size_t>(zse->payload_end - zse->payload);
+	copied = HistoryLog::Instance().Read(off, start, end, zse->payload_mut,
+					     available > kTrailerSize ? available - kTrailerSize : 0);
+	if (copied < 0) {
+		return copied == -EAGAIN ? MGMT_ERR_EBUSY : MGMT_ERR_EMSGSIZE;
+	}
+
+	zse->payload_mut += copied;
+	if (!zcbor_bstr_end_encode(zse, nullptr)) {
+		return MGMT_ERR_EMSGSIZE;
+	}
+
+	HistoryLog::Instance().GetRange(first, next);
+	if (off < next && !(zcbor_tstr_put_lit(zse, "off") && zcbor_uint32_put(zse, off))) {
+		return MGMT_ERR_EMSGSIZE;
+	}
+
+	return MGMT_ERR_EOK;
+}
+
+/* Indexed by HistorySmp::Command. */
+const struct mgmt_handler sHistoryHandlers[] = {
+	{ HistoryInfo, nullptr },
+	{ HistoryRead, nullptr },
+};
+
+struct mgmt_group sHistoryGroup;
+
+} /* namespace */
+
+void HistorySmp::Init()
+{
+	sHistoryGroup.mg_handlers = sHistoryHandlers;
+	sHistoryGroup.mg_handlers_count = ARRAY_SIZE(sHistoryHandlers);
+	sHistoryGroup.mg_group_id = CONFIG_APP_HISTORY_SMP_GROUP_ID;
+
+	mgmt_register_group(&sHistoryGroup);
+}
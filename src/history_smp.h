@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+/*
+ * SMP (mcumgr) command group giving access to the history log without commissioning the device, for example from a
+ * phone connected over the SMP Bluetooth service. The group has two read commands:
+ *
+ * - info (0): returns the "first" and "next" sequence numbers, the "capacity" in samples and the "size" of a sample.
+ * - read (1): takes optional "start" and "end" timestamps and the "off" sequence number to continue from. It
+ *   returns "data", the packed samples in the range that fit in the response, and "off" to pass with the next
+ *   request if there are more samples to read.
+ *
+ * The samples are little-endian: a 32-bit timestamp, the 16-bit temperature and the 16-bit humidity.
+ */
+class HistorySmp {
+public:
+	enum Command : uint8_t { kInfo = 0, kRead = 1 };
+
+	static HistorySmp &Instance()
+	{
+		static HistorySmp sHistorySmp;
+		return sHistorySmp;
+	}
+
+	void Init();
+};
@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "im_stats.h"
+
+#include <matter/tracing/build_config.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <protocols/interaction_model/Constants.h>
+#include <tracing/registry.h>
+#include <transport/SecureSession.h>
+#include <transport/TracingStructs.h>
+
+#include <zephyr/logging/log.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/util.h>
+
+#include <string.h>
+
+#if !MATTER_TRACING_ENABLED
+#error "CONFIG_APP_IM_STATS requires the Matter library to be built with tracing support"
+#endif
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+using namespace ::chip::app;
+using namespace ::chip::Tracing;
+using MsgType = ::chip::Protocols::InteractionModel::MsgType;
+
+namespace {
+
+constexpr const char *kOperationNames[ImStats::kOperationCount] = { "read", "subscribe", "report", "invoke" };
+
+} /* namespace */
+
+CHIP_ERROR ImStats::Init()
+{
+	Reset();
+
+	Register(*this);
+
+	return CHIP_NO_ERROR;
+}
+
+void ImStats::Reset()
+{
+	memset(mClusters, 0, sizeof(mClusters));
+	memset(mExchanges, 0, sizeof(mExchanges));
+	memset(mHistograms, 0, sizeof(mHistograms));
+	mUntrackedClusters = 0;
+	mUntrackedExchanges = 0;
+}
+
+ImStats::Cluster *ImStats::FindCluster(ClusterId id)
+{
+	Cluster *free = nullptr;
+
+	for (Cluster &cluster : mClusters) {
+		if (cluster.mInUse && cluster.mId == id) {
+			return &cluster;
+		}
+
+		if (!free && !cluster.mInUse) {
+			free = &cluster;
+		}
+	}
+
+	if (!free) {
+		mUntrackedClusters++;
+		return nullptr;
+	}
+
+	free->mInUse = true;
+	free->mId = id;
+
+	return free;
+}
+
+ImStats::Exchange *ImStats::FindExchange(uint16_t peerSessionId, uint16_t exchangeId)
+{
+	for (Exchange &exchange : mExchanges) {
+		if (exchange.mInUse && exchange.mPeerSessionId == peerSessionId && exchange.mExchangeId == exchangeId) {
+			return &exchange;
+		}
+	}
+
+	return nullptr;
+}
+
+void ImStats::AddSample(Operation operation, uint32_t cycles)
+{
+	Histogram &histogram = mHistograms[operation];
+	uint32_t us = k_cyc_to_us_floor32(cycles);
+	size_t bucket = 0;
+
+	while (bucket < ARRAY_SIZE(kBucketLimitsUs) && us >= kBucketLimitsUs[bucket]) {
+		bucket++;
+	}
+
+	histogram.mCount++;
+	histogram.mBuckets[bucket]++;
+	histogram.mMaxUs = MAX(histogram.mMaxUs, us);
+}
+
+void ImStats::Attribute(Operation operation)
+{
+	uint32_t cycles = 0;
+
+	for (Cluster &cluster : mClusters) {
+		cluster.mCount[operation] += cluster.mPendingCount;
+		cluster.mCycles[operation] += cluster.mPendingCycles;
+		cycles += cluster.mPendingCycles;
+		cluster.mPendingCount = 0;
+		cluster.mPendingCycles = 0;
+	}
+
+	if (operation == kReport) {
+		AddSample(kReport, cycles);
+	}
+}
+
+void ImStats::OnAttributeRead(ClusterId id, uint32_t cycles)
+{
+	Cluster *cluster = FindCluster(id);
+
+	if (cluster) {
+		cluster->mPendingCount++;
+		cluster->mPendingCycles += cycles;
+	}
+}
+
+void ImStats::OnCommandHandled(ClusterId id, uint32_t cycles)
+{
+	Cluster *cluster = FindCluster(id);
+
+	if (cluster) {
+		cluster->mCount[kInvoke]++;
+		cluster->mCycles[kInvoke] += cycles;
+	}
+}
+
+void ImStats::LogMessageReceived(MessageReceivedInfo &info)
+{
+	if (info.messageType != IncomingMessageType::kSecureUnicast || info.session == nullptr ||
+	    info.session->GetSessionType() != Transport::Session::SessionType::kSecure ||
+	    !info.payloadHeader->IsInitiator()) {
+		return;
+	}
+
+	Operation operation;
+
+	if (info.payloadHeader->HasMessageType(MsgType::ReadRequest)) {
+		operation = kRead;
+	} else if (info.payloadHeader->HasMessageType(MsgType::SubscribeRequest)) {
+		operation = kSubscribe;
+	} else if (info.payloadHeader->HasMessageType(MsgType::InvokeCommandRequest)) {
+		operation = kInvoke;
+	} else {
+		return;
+	}
+
+	Exchange *oldest = nullptr;
+
+	for (Exchange &exchange : mExchanges) {
+		if (!exchange.mInUse) {
+			oldest = &exchange;
+			break;
+		}
+
+		if (!oldest || static_cast<int32_t>(exchange.mStart - oldest->mStart) < 0) {
+			oldest = &exchange;
+		}
+	}
+
+	/*
+	 * Answered reads stay in the table in case more chunks follow, unanswered requests would otherwise block it.
+	 * Only the latter are lost.
+	 */
+	if (oldest->mInUse && !oldest->mResponded) {
+		mUntrackedExchanges++;
+	}
+
+	*oldest = { true, false, operation, info.session->AsConstSecureSession()->GetPeerSessionId(),
+		    info.payloadHeader->GetExchangeID(), k_cycle_get_32() };
+}
+
+void ImStats::LogMessageSend(MessageSendInfo &info)
+{
+	if (info.messageType != OutgoingMessageType::kSecureSession ||
+	    !info.payloadHeader->HasProtocol(Protocols::InteractionModel::Id)) {
+		return;
+	}
+
+	const PayloadHeader &header = *info.payloadHeader;
+	bool isReport = header.HasMessageType(MsgType::ReportData);
+
+	if (header.IsInitiator()) {
+		/* Reports of established subscriptions are the only IM interactions initiated by the device. */
+		if (isReport) {
+			Attribute(kReport);
+		}
+
+		return;
+	}
+
+	Exchange *exchange = FindExchange(info.packetHeader->GetSessionId(), header.GetExchangeID());
+
+	if (!exchange) {
+		return;
+	}
+
+	if (!exchange->mResponded) {
+		exchange->mResponded = true;
+		AddSample(exchange->mOperation, k_cycle_get_32() - exchange->mStart);
+	}
+
+	if (isReport) {
+		/* Chunked read and priming reports keep the exchange until the last chunk. */
+		Attribute(exchange->mOperation);
+	} else {
+		exchange->mInUse = false;
+	}
+}
+
+DataModel::ActionReturnStatus ImStatsDataModelProvider::ReadAttribute(const DataModel::ReadAttributeRequest &request,
+								       AttributeValueEncoder &encoder)
+{
+	uint32_t start = k_cycle_get_32();
+	DataModel::ActionReturnStatus status = CodegenDataModelProvider::ReadAttribute(request, encoder);
+
+	ImStats::Instance().OnAttributeRead(request.path.mClusterId, k_cycle_get_32() - start);
+
+	return status;
+}
+
+std::optional<DataModel::ActionReturnStatus>
+ImStatsDataModelProvider::Invoke(const DataModel::InvokeRequest &request, TLV::TLVReader &inputArguments,
+				 CommandHandler *handler)
+{
+	ImStats::CommandScope statsScope(request.path.mClusterId);
+
+	return CodegenDataModelProvider::Invoke(request, inputArguments, handler);
+}
+
+#ifdef CONFIG_SHELL
+void ImStats::Print(const struct shell *shell)
+{
+	shell_print(shell, "%-10s %-10s %-8s %-10s", "cluster", "operation", "count", "total_us");
+
+	for (const Cluster &cluster : mClusters) {
+		if (!cluster.mInUse) {
+			continue;
+		}
+
+		for (size_t op = 0; op < kOperationCount; op++) {
+			if (cluster.mCount[op] == 0) {
+				continue;
+			}
+
+			shell_print(shell, "0x%08x %-10s %-8u %-10u", cluster.mId, kOperationNames[op], cluster.mCount[op],
+				    static_cast<uint32_t>(k_cyc_to_us_floor64(cluster.mCycles[op])));
+		}
+	}
+
+	shell_print(shell, "");
+	shell_fprintf(shell, SHELL_NORMAL, "%-10s %-6s %-8s", "operation", "count", "max_us");
+
+	for (uint32_t limit : kBucketLimitsUs) {
+		shell_fprintf(shell, SHELL_NORMAL, " <%-6u", limit);
+	}
+
+	shell_fprintf(shell, SHELL_NORMAL, " >=%u\n", kBucketLimitsUs[ARRAY_SIZE(kBucketLimitsUs) - 1]);
+
+	for (size_t op = 0; op < kOperationCount; op++) {
+		const Histogram &histogram = mHistograms[op];
+
+		shell_fprintf(shell, SHELL_NORMAL, "%-10s %-6u %-8u", kOperationNames[op], histogram.mCount,
+			      histogram.mMaxUs);
+
+		for (uint32_t count : histogram.mBuckets) {
+			shell_fprintf(shell, SHELL_NORMAL, " %-7u", count);
+		}
+
+		shell_fprintf(shell, SHELL_NORMAL, "\n");
+	}
+
+	shell_print(shell, "untracked: clusters %u, exchanges %u", mUntrackedClusters, mUntrackedExchanges);
+}
+
+static int ImStatsShowHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::StackLock lock;
+
+	ImStats::Instance().Print(shell);
+	return 0;
+}
+
+static int ImStatsResetHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::StackLock lock;
+
+	ImStats::Instance().Reset();
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_im_stats,
+			       SHELL_CMD_ARG(show, NULL, "Print the IM load per cluster and the service time histograms",
+					     ImStatsShowHandler, 1, 0),
+			       SHELL_CMD_ARG(reset, NULL, "Reset the IM statistics", ImStatsResetHandler, 1, 0),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((app), im, &sub_im_stats, "Interaction Model load statistics", NULL, 1, 0);
+#endif /* CONFIG_SHELL */
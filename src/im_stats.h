@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <app/codegen-data-model-provider/CodegenDataModelProvider.h>
+#include <lib/core/DataModelTypes.h>
+#include <tracing/backend.h>
+
+#include <zephyr/kernel.h>
+
+#include <optional>
+
+struct shell;
+
+/*
+ * Interaction Model load per cluster and operation, used to find out which clusters and which kind of interaction
+ * take the Matter thread time of the device.
+ *
+ * Attribute reads and commands are timed by ImStatsDataModelProvider, which the server uses in place of the default
+ * data model provider. The attributes read since the last IM message was sent are
+ * attributed to the interaction of that message: the read or subscribe request received on the same exchange, or a
+ * subscription report when the device initiated the exchange. The messages are observed through the Matter tracing
+ * backend interface. Each operation also has a histogram of its service time: from the request to the first
+ * response for reads, subscriptions and commands, and the time spent encoding the attributes for reports.
+ */
+class ImStats : public chip::Tracing::Backend {
+public:
+	enum Operation : uint8_t { kRead, kSubscribe, kReport, kInvoke, kOperationCount };
+
+	/* Upper bounds of the histogram buckets in microseconds, the last bucket is unbounded. */
+	static constexpr uint32_t kBucketLimitsUs[] = { 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000 };
+	static constexpr size_t kBucketCount = ARRAY_SIZE(kBucketLimitsUs) + 1;
+
+	/* Times the handling of a command dispatched to a cluster. */
+	class CommandScope {
+	public:
+		explicit CommandScope(chip::ClusterId cluster) : mCluster(cluster), mStart(k_cycle_get_32()) {}
+		~CommandScope() { Instance().OnCommandHandled(mCluster, k_cycle_get_32() - mStart); }
+
+	private:
+		chip::ClusterId mCluster;
+		uint32_t mStart;
+	};
+
+	static ImStats &Instance()
+	{
+		static ImStats sImStats;
+		return sImStats;
+	}
+
+	CHIP_ERROR Init();
+	void Reset();
+	void Print(const struct shell *shell);
+
+	/* Called on the Matter thread. */
+	void OnAttributeRead(chip::ClusterId cluster, uint32_t cycles);
+	void OnCommandHandled(chip::ClusterId cluster, uint32_t cycles);
+
+	/* chip::Tracing::Backend */
+	void LogMessageSend(chip::Tracing::MessageSendInfo &info) override;
+	void LogMessageReceived(chip::Tracing::MessageReceivedInfo &info) override;
+
+private:
+	struct Cluster {
+		bool mInUse;
+		chip::ClusterId mId;
+		uint32_t mCount[kOperationCount];
+		uint64_t mCycles[kOperationCount];
+		/* Attributes read and not yet attributed to an interaction. */
+		uint32_t mPendingCount;
+		uint32_t mPendingCycles;
+	};
+
+	struct Exchange {
+		bool mInUse;
+		bool mResponded;
+		Operation mOperation;
+		uint16_t mPeerSessionId;
+		uint16_t mExchangeId;
+		uint32_t mStart;
+	};
+
+	struct Histogram {
+		uint32_t mCount;
+		uint32_t mBuckets[kBucketCount];
+		uint32_t mMaxUs;
+	};
+
+	Cluster *FindCluster(chip::ClusterId id);
+	Exchange *FindExchange(uint16_t peerSessionId, uint16_t exchangeId);
+	void Attribute(Operation operation);
+	void AddSample(Operation operation, uint32_t cycles);
+
+	Cluster mClusters[CONFIG_APP_IM_STATS_MAX_CLUSTERS];
+	Exchange mExchanges[CONFIG_APP_IM_STATS_MAX_EXCHANGES];
+	Histogram mHistograms[kOperationCount];
+	uint32_t mUntrackedClusters{ 0 };
+	uint32_t mUntrackedExchanges{ 0 };
+};
+
+/* Default data model provider timing every attribute read and command for ImStats. */
+class ImStatsDataModelProvider : public chip::app::CodegenDataModelProvider {
+public:
+	chip::app::DataModel::ActionReturnStatus ReadAttribute(const chip::app::DataModel::ReadAttributeRequest &request,
+							       chip::app::AttributeValueEncoder &encoder) override;
+	std::optional<chip::app::DataModel::ActionReturnStatus>
+	Invoke(const chip::app::DataModel::InvokeRequest &request, chip::TLV::TLVReader &inputArguments,
+	       chip::app::CommandHandler *handler) override;
+};
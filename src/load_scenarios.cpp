@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "load_scenarios.h"
+
+#include "event_triggers/event_triggers.h"
+
+#include <app-common/zap-generated/ids/Attributes.h>
+#include <app-common/zap-generated/ids/Clusters.h>
+#include <app/reporting/reporting.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <zephyr/logging/log.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/util.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+using namespace ::chip::app;
+
+namespace {
+
+constexpr const char *kScenarioNames[LoadScenarios::kScenarioCount] = { "none", "burst", "ramp", "reports", "fault" };
+
+constexpr EndpointId kSensorEndpointId = 1;
+/* The ramp restarts from the measured values after this offset, in degrees Celsius and percents. */
+constexpr float kRampSpan = 10.0f;
+
+/* Scenario in bits 16-31 and duration in bits 0-15 of the trigger value. */
+constexpr Nrf::Matter::TestEventTrigger::TriggerValue kTriggerValueMask = 0xFFFF'FFFF;
+
+CHIP_ERROR HandleTrigger(Nrf::Matter::TestEventTrigger::TriggerValue value)
+{
+	uint32_t scenario = (value >> 16) & UINT16_MAX;
+
+	if (scenario == LoadScenarios::kNone) {
+		LoadScenarios::Instance().Stop();
+		return CHIP_NO_ERROR;
+	}
+
+	if (scenario >= LoadScenarios::kScenarioCount) {
+		return CHIP_ERROR_INVALID_ARGUMENT;
+	}
+
+	return LoadScenarios::Instance().Start(static_cast<LoadScenarios::Scenario>(scenario), value & UINT16_MAX);
+}
+
+void ForceReportsWork(intptr_t context)
+{
+	MatterReportingAttributeChangeCallback(kSensorEndpointId, Clusters::TemperatureMeasurement::Id,
+					       Clusters::TemperatureMeasurement::Attributes::MeasuredValue::Id);
+	MatterReportingAttributeChangeCallback(kSensorEndpointId, Clusters::RelativeHumidityMeasurement::Id,
+					       Clusters::RelativeHumidityMeasurement::Attributes::MeasuredValue::Id);
+}
+
+} /* namespace */
+
+CHIP_ERROR LoadScenarios::Init(k_tid_t sensorThread)
+{
+	mSensorThread = sensorThread;
+
+	return Nrf::Matter::TestEventTrigger::Instance().RegisterTestEventTrigger(
+		kTriggerBase, Nrf::Matter::TestEventTrigger::EventTrigger{ kTriggerValueMask, HandleTrigger });
+}
+
+CHIP_ERROR LoadScenarios::Start(Scenario scenario, uint32_t durationS)
+{
+	VerifyOrReturnError(scenario > kNone && scenario < kScenarioCount, CHIP_ERROR_INVALID_ARGUMENT);
+
+	if (durationS == 0) {
+		durationS = CONFIG_APP_LOAD_SCENARIOS_DURATION_S;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+
+	mScenario = scenario;
+	mEndMs = k_uptime_get() + static_cast<int64_t>(durationS) * MSEC_PER_SEC;
+	mRampOffset = 0.0f;
+	mCounters[scenario].mRuns++;
+
+	k_spin_unlock(&mLock, key);
+
+	LOG_INF("Load scenario %s started for %u s", kScenarioNames[scenario], durationS);
+
+	/* Apply the scenario period now rather than after the current one. */
+	if (mSensorThread) {
+		k_wakeup(mSensorThread);
+	}
+
+	return CHIP_NO_ERROR;
+}
+
+void LoadScenarios::Stop()
+{
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+	Scenario scenario = mScenario;
+
+	mScenario = kNone;
+
+	k_spin_unlock(&mLock, key);
+
+	if (scenario != kNone) {
+		LOG_INF("Load scenario %s stopped", kScenarioNames[scenario]);
+	}
+}
+
+void LoadScenarios::Reset()
+{
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+
+	memset(mCounters, 0, sizeof(mCounters));
+
+	k_spin_unlock(&mLock, key);
+}
+
+LoadScenarios::Counters LoadScenarios::Get(Scenario scenario)
+{
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+	Counters counters = mCounters[scenario];
+
+	k_spin_unlock(&mLock, key);
+
+	return counters;
+}
+
+LoadScenarios::Sample LoadScenarios::OnSample(float temperatureC, float humidityRH, uint32_t &periodMs)
+{
+	Sample sample = { true, temperatureC, humidityRH };
+	bool finished = false;
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+	Scenario scenario = mScenario;
+
+	if (scenario != kNone && k_uptime_get() >= mEndMs) {
+		mScenario = kNone;
+		finished = true;
+	} else if (scenario != kNone) {
+		Counters &counters = mCounters[scenario];
+
+		counters.mSamples++;
+
+		switch (scenario) {
+		case kRamp:
+			mRampOffset += CONFIG_APP_LOAD_SCENARIOS_RAMP_STEP / 100.0f;
+			if (mRampOffset > kRampSpan) {
+				mRampOffset = 0.0f;
+			}
+			sample.mTemperatureC += mRampOffset;
+			sample.mHumidityRH = CLAMP(sample.mHumidityRH + mRampOffset, 0.0f, 100.0f);
+			break;
+		case kReports:
+			counters.mForcedReports++;
+			break;
+		case kFault:
+			counters.mFaults++;
+			sample.mValid = false;
+			break;
+		default:
+			break;
+		}
+
+		if (scenario != kFault) {
+			periodMs = MIN(periodMs, CONFIG_APP_LOAD_SCENARIOS_FAST_PERIOD_MS);
+		}
+	}
+
+	k_spin_unlock(&mLock, key);
+
+	if (finished) {
+		Counters counters = Get(scenario);
+
+		LOG_INF("Load scenario %s finished: %u samples", kScenarioNames[scenario], counters.mSamples);
+	}
+
+	if (scenario == kReports && !finished) {
+		DeviceLayer::PlatformMgr().ScheduleWork(ForceReportsWork);
+	}
+
+	return sample;
+}
+
+#ifdef CONFIG_SHELL
+void LoadScenarios::Print(const struct shell *shell)
+{
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+	Scenario running = mScenario;
+	int64_t remainingMs = mEndMs - k_uptime_get();
+
+	k_spin_unlock(&mLock, key);
+
+	shell_print(shell, "%-8s %-6s %-8s %-14s %-8s", "scenario", "runs", "samples", "forced_reports", "faults");
+
+	for (size_t i = kNone + 1; i < kScenarioCount; i++) {
+		Counters counters = Get(static_cast<Scenario>(i));
+
+		shell_print(shell, "%-8s %-6u %-8u %-14u %-8u", kScenarioNames[i], counters.mRuns, counters.mSamples,
+			    counters.mForcedReports, counters.mFaults);
+	}
+
+	if (running != kNone) {
+		shell_print(shell, "running: %s, %lld ms left", kScenarioNames[running],
+			    static_cast<long long>(MAX(remainingMs, 0)));
+	}
+}
+
+static int LoadScenariosShowHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	LoadScenarios::Instance().Print(shell);
+	return 0;
+}
+
+static int LoadScenariosStartHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	uint32_t durationS = argc > 2 ? strtoul(argv[2], nullptr, 10) : 0;
+
+	for (size_t i = LoadScenarios::kNone + 1; i < LoadScenarios::kScenarioCount; i++) {
+		if (strcmp(argv[1], kScenarioNames[i]) == 0) {
+			LoadScenarios::Instance().Start(static_cast<LoadScenarios::Scenario>(i), durationS);
+			return 0;
+		}
+	}
+
+	shell_error(shell, "Unknown scenario: %s", argv[1]);
+	return -EINVAL;
+}
+
+static int LoadScenariosStopHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	LoadScenarios::Instance().Stop();
+	return 0;
+}
+
+static int LoadScenariosResetHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	LoadScenarios::Instance().Reset();
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(
+	sub_load_scenarios,
+	SHELL_CMD_ARG(show, NULL, "Print the load scenario counters", LoadScenariosShowHandler, 1, 0),
+	SHELL_CMD_ARG(start, NULL, "Start a load scenario: <burst|ramp|reports|fault> [duration_s]",
+		      LoadScenariosStartHandler, 2, 1),
+	SHELL_CMD_ARG(stop, NULL, "Stop the running load scenario", LoadScenariosStopHandler, 1, 0),
+	SHELL_CMD_ARG(reset, NULL, "Reset the load scenario counters", LoadScenariosResetHandler, 1, 0),
+	SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((app), scenario, &sub_load_scenarios, "Synthetic load scenarios", NULL, 1, 0);
+#endif /* CONFIG_SHELL */
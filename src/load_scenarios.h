@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+
+#include <zephyr/kernel.h>
+
+#include <stdint.h>
+
+struct shell;
+
+/*
+ * Synthetic load scenarios of the sensor pipeline, started from a controller with the TestEventTrigger command of the
+ * General Diagnostics cluster to run reproducible performance tests on a commissioned device:
+ *
+ * - burst: samples every CONFIG_APP_LOAD_SCENARIOS_FAST_PERIOD_MS,
+ * - ramp: same, and moves both measurements by CONFIG_APP_LOAD_SCENARIOS_RAMP_STEP at every sample,
+ * - reports: same, and marks both measurements dirty at every sample, so the subscriptions report at the rate
+ *   allowed by their minimum interval even when the values do not change,
+ * - fault: the sensor fails at every sample and the measurements become null.
+ *
+ * The event trigger is kTriggerBase | (scenario << 16) | duration in seconds, a zero duration selects
+ * CONFIG_APP_LOAD_SCENARIOS_DURATION_S, and scenario 0 stops the running one. The runs are counted per scenario and
+ * printed with the "app scenario show" shell command.
+ */
+class LoadScenarios {
+public:
+	enum Scenario : uint8_t { kNone, kBurst, kRamp, kReports, kFault, kScenarioCount };
+
+	static constexpr uint64_t kTriggerBase = 0xFFF1'0000'0000'0000;
+
+	/* Measurements to publish for a sample, after the running scenario was applied. */
+	struct Sample {
+		bool mValid;
+		float mTemperatureC;
+		float mHumidityRH;
+	};
+
+	struct Counters {
+		uint32_t mRuns;
+		uint32_t mSamples;
+		uint32_t mForcedReports;
+		uint32_t mFaults;
+	};
+
+	static LoadScenarios &Instance()
+	{
+		static LoadScenarios sLoadScenarios;
+		return sLoadScenarios;
+	}
+
+	CHIP_ERROR Init(k_tid_t sensorThread);
+	CHIP_ERROR Start(Scenario scenario, uint32_t durationS);
+	void Stop();
+	void Reset();
+	Counters Get(Scenario scenario);
+	void Print(const struct shell *shell);
+
+	/* Called by the sensor thread for every sample, may shorten the sampling period. */
+	Sample OnSample(float temperatureC, float humidityRH, uint32_t &periodMs);
+
+private:
+	struct k_spinlock mLock;
+	k_tid_t mSensorThread{ nullptr };
+	Scenario mScenario{ kNone };
+	int64_t mEndMs{ 0 };
+	float mRampOffset{ 0.0f };
+	Counters mCounters[kScenarioCount]{};
+};
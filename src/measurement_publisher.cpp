@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "measurement_publisher.h"
+
+#include <app/server/Server.h>
+#include <controller/InvokeInteraction.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <transport/Session.h>
+
+#include <zephyr/logging/log.h>
+#include <zephyr/shell/shell.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+using namespace ::chip::app;
+
+namespace {
+
+constexpr EndpointId kPublisherEndpointId = 1;
+
+/*
+ * Request objects of the Measurement Sink cluster commands. The cluster is manufacturer specific, so they are not
+ * part of the cluster objects generated for the Matter SDK.
+ */
+namespace MeasurementSink {
+
+constexpr ClusterId kId = 0xFFF1FC44;
+
+struct MeasurementsChanged {
+	static constexpr bool kIsFabricScoped = false;
+	using ResponseType = DataModel::NullObjectType;
+
+	static constexpr ClusterId GetClusterId() { return kId; }
+	static constexpr CommandId GetCommandId() { return 0x00; }
+	static constexpr bool MustUseTimedInvoke() { return false; }
+
+	/* A missing optional field is not encoded, so a target can tell which values changed. */
+	CHIP_ERROR Encode(TLV::TLVWriter &writer, TLV::Tag tag) const
+	{
+		TLV::TLVType outer;
+
+		ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
+		ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(0), temperature));
+		ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(1), humidity));
+		return writer.EndContainer(outer);
+	}
+
+	Optional<int16_t> temperature;
+	Optional<uint16_t> humidity;
+};
+
+} /* namespace MeasurementSink */
+
+CHIP_ERROR SendMeasurement(const EmberBindingTableEntry &binding, OperationalDeviceProxy *peer,
+			   const MeasurementSink::MeasurementsChanged &request)
+{
+	if (binding.type == MATTER_MULTICAST_BINDING) {
+		return Controller::InvokeGroupCommandRequest(&Server::GetInstance().GetExchangeManager(),
+							     binding.fabricIndex, binding.groupId, request);
+	}
+
+	auto onSuccess = [](const ConcreteCommandPath &path, const StatusIB &status,
+			    const MeasurementSink::MeasurementsChanged::ResponseType &response) {};
+	auto onFailure = [](CHIP_ERROR error) {
+		LOG_DBG("Publication failed: %" CHIP_ERROR_FORMAT, error.Format());
+	};
+
+	return Controller::InvokeCommandRequest(peer->GetExchangeManager(), peer->GetSecureSession().Value(),
+						binding.remote, request, onSuccess, onFailure);
+}
+
+} /* namespace */
+
+CHIP_ERROR MeasurementPublisher::Init()
+{
+	BindingManager &manager = BindingManager::GetInstance();
+
+	ReturnErrorOnFailure(manager.Init({ &Server::GetInstance().GetFabricTable(),
+					    Server::GetInstance().GetCASESessionManager(),
+					    &Server::GetInstance().GetPersistentStorage() }));
+	manager.RegisterBoundDeviceChangedHandler(BoundDeviceChangedHandler);
+	manager.RegisterBoundDeviceContextReleaseHandler(BoundDeviceContextReleaseHandler);
+
+	return CHIP_NO_ERROR;
+}
+
+void MeasurementPublisher::Publish(int16_t temperature, uint16_t humidity)
+{
+	/* Both values fit in the context word, which spares a heap allocation per sample. */
+	intptr_t context = static_cast<intptr_t>((static_cast<uint32_t>(static_cast<uint16_t>(temperature)) << 16) |
+						 humidity);
+
+	DeviceLayer::PlatformMgr().ScheduleWork(PublishWork, context);
+}
+
+void MeasurementPublisher::PublishWork(intptr_t context)
+{
+	MeasurementPublisher &publisher = Instance();
+	int16_t temperature = static_cast<int16_t>(static_cast<uint32_t>(context) >> 16);
+	uint16_t humidity = static_cast<uint16_t>(context & UINT16_MAX);
+	Measurement measurement;
+
+	if (!publisher.mPublished || publisher.mLastTemperature != temperature) {
+		measurement.mTemperature.SetValue(temperature);
+	}
+
+	if (!publisher.mPublished || publisher.mLastHumidity != humidity) {
+		measurement.mHumidity.SetValue(humidity);
+	}
+
+	if (measurement.mTemperature.HasValue() || measurement.mHumidity.HasValue()) {
+		publisher.Notify(measurement);
+	}
+
+	publisher.mPublished = true;
+	publisher.mLastTemperature = temperature;
+	publisher.mLastHumidity = humidity;
+}
+
+void MeasurementPublisher::Notify(const Measurement &value)
+{
+	Measurement *measurement = Platform::New<Measurement>(value);
+
+	if (measurement == nullptr) {
+		mFailures++;
+		return;
+	}
+
+	mReadings++;
+
+	CHIP_ERROR err =
+		BindingManager::GetInstance().NotifyBoundClusterChanged(kPublisherEndpointId, MeasurementSink::kId,
+									measurement);
+
+	if (err != CHIP_NO_ERROR) {
+		LOG_ERR("Failed to publish measurements: %" CHIP_ERROR_FORMAT, err.Format());
+		Platform::Delete(measurement);
+		mFailures++;
+	}
+}
+
+void MeasurementPublisher::BoundDeviceChangedHandler(const EmberBindingTableEntry &binding,
+						     OperationalDeviceProxy *peer, void *context)
+{
+	MeasurementPublisher &publisher = Instance();
+	const Measurement *measurement = static_cast<const Measurement *>(context);
+
+	if (measurement == nullptr || !binding.clusterId.has_value() ||
+	    binding.clusterId.value() != MeasurementSink::kId) {
+		return;
+	}
+
+	if (binding.type == MATTER_UNICAST_BINDING && peer == nullptr) {
+		return;
+	}
+
+	MeasurementSink::MeasurementsChanged request{ measurement->mTemperature, measurement->mHumidity };
+	CHIP_ERROR err = SendMeasurement(binding, peer, request);
+
+	if (binding.type == MATTER_MULTICAST_BINDING) {
+		publisher.mGroupMessages++;
+	} else {
+		publisher.mUnicastMessages++;
+	}
+
+	if (err != CHIP_NO_ERROR) {
+		LOG_ERR("Failed to send publication: %" CHIP_ERROR_FORMAT, err.Format());
+		publisher.mFailures++;
+	}
+}
+
+void MeasurementPublisher::BoundDeviceContextReleaseHandler(void *context)
+{
+	Platform::Delete(static_cast<Measurement *>(context));
+}
+
+#ifdef CONFIG_SHELL
+void MeasurementPublisher::PrintStats(const struct shell *shell)
+{
+	shell_print(shell, "readings: %u, group messages: %u, unicast messages: %u, failures: %u", mReadings,
+		    mGroupMessages, mUnicastMessages, mFailures);
+}
+
+static int PublisherStatsHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::StackLock lock;
+
+	MeasurementPublisher::Instance().PrintStats(shell);
+	return 0;
+}
+
+SHELL_SUBCMD_ADD((app), publish, NULL, "Print measurement publication statistics", PublisherStatsHandler, 1, 0);
+#endif /* CONFIG_SHELL */
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <app/clusters/bindings/BindingManager.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/Optional.h>
+
+struct shell;
+
+/*
+ * Pushes measured values to the targets bound to the manufacturer specific Measurement Sink cluster (0xFFF1FC44) on
+ * endpoint 1. A group binding costs a single multicast message regardless of the number of group members, a unicast
+ * binding one message per target. A reading is sent as a single MeasurementsChanged command of the Measurement Sink
+ * cluster carrying the values that changed, so the targets must implement its server side and grant this node
+ * operate access. Subscriptions keep working in parallel.
+ */
+class MeasurementPublisher {
+public:
+	static MeasurementPublisher &Instance()
+	{
+		static MeasurementPublisher sMeasurementPublisher;
+		return sMeasurementPublisher;
+	}
+
+	CHIP_ERROR Init();
+
+	/* Thread-safe, the publication is scheduled on the Matter thread. */
+	void Publish(int16_t temperature, uint16_t humidity);
+	void PrintStats(const struct shell *shell);
+
+private:
+	struct Measurement {
+		chip::Optional<int16_t> mTemperature;
+		chip::Optional<uint16_t> mHumidity;
+	};
+
+	static void PublishWork(intptr_t context);
+	static void BoundDeviceChangedHandler(const EmberBindingTableEntry &binding,
+					      chip::OperationalDeviceProxy *peer, void *context);
+	static void BoundDeviceContextReleaseHandler(void *context);
+
+	void Notify(const Measurement &measurement);
+
+	bool mPublished{ false };
+	uint32_t mReadings{ 0 };
+	int16_t mLastTemperature;
+	uint16_t mLastHumidity;
+	uint32_t mGroupMessages{ 0 };
+	uint32_t mUnicastMessages{ 0 };
+	uint32_t mFailures{ 0 };
+};
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "memory_diagnostics_cluster.h"
+
+#ifdef CONFIG_APP_HEAP_STATS
+#include "heap_stats.h"
+#endif
+
+#include <app/AttributeAccessInterface.h>
+#include <app/AttributeAccessInterfaceRegistry.h>
+#include <app/data-model/Nullable.h>
+
+using namespace ::chip;
+using namespace ::chip::app;
+
+namespace MemoryDiagnostics {
+namespace {
+
+class MemoryAttrAccess : public AttributeAccessInterface {
+public:
+	MemoryAttrAccess() : AttributeAccessInterface(MakeOptional(kRootEndpointId), kClusterId) {}
+
+	CHIP_ERROR Read(const ConcreteReadAttributePath &path, AttributeValueEncoder &encoder) override
+	{
+		if (path.mAttributeId > Attributes::kPacketBuffersPeak) {
+			/* Global attributes are served from the attribute storage. */
+			return CHIP_NO_ERROR;
+		}
+
+		DataModel::Nullable<uint32_t> value;
+
+#ifdef CONFIG_APP_HEAP_STATS
+		if (path.mAttributeId >= Attributes::kPacketBuffersInUse) {
+			HeapStats::PacketBuffers buffers = HeapStats::Instance().GetPacketBuffers();
+
+			value.SetNonNull(path.mAttributeId == Attributes::kPacketBuffersInUse ? buffers.mInUse :
+												  buffers.mPeak);
+		} else {
+			AttributeId offset = path.mAttributeId - Attributes::kFirstHeapAttribute;
+			HeapStats::Usage usage = HeapStats::Instance().Get(
+				static_cast<HeapStats::Heap>(offset / Attributes::kAttributesPerHeap));
+
+			if (usage.mTracked) {
+				const uint32_t values[Attributes::kAttributesPerHeap] = { usage.mUsed, usage.mPeak,
+											   usage.mFailures };
+
+				value.SetNonNull(values[offset % Attributes::kAttributesPerHeap]);
+			}
+		}
+#endif
+		return encoder.Encode(value);
+	}
+};
+
+MemoryAttrAccess sAttrAccess;
+
+} /* namespace */
+} /* namespace MemoryDiagnostics */
+
+void MatterMemoryDiagnosticsPluginServerInitCallback()
+{
+	AttributeAccessInterfaceRegistry::Instance().Register(&MemoryDiagnostics::sAttrAccess);
+}
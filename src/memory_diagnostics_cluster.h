@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <lib/core/DataModelTypes.h>
+
+/*
+ * Manufacturer specific Memory Diagnostics cluster on endpoint 0, defined in
+ * src/default_zap/memory-diagnostics-cluster.xml. The attributes are read from HeapStats on demand and are null when
+ * CONFIG_APP_HEAP_STATS is disabled or the heap cannot be tracked in the build.
+ */
+namespace MemoryDiagnostics {
+
+inline constexpr chip::ClusterId kClusterId = 0xFFF1FC41;
+
+namespace Attributes {
+/* Used, peak and failures of each HeapStats heap, in the order of HeapStats::Heap. */
+inline constexpr chip::AttributeId kFirstHeapAttribute = 0x0000;
+inline constexpr chip::AttributeId kAttributesPerHeap = 3;
+inline constexpr chip::AttributeId kPacketBuffersInUse = 0x0006;
+inline constexpr chip::AttributeId kPacketBuffersPeak = 0x0007;
+} /* namespace Attributes */
+
+} /* namespace MemoryDiagnostics */
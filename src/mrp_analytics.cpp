@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "mrp_analytics.h"
+
+#if APP_MRP_ANALYTICS_AVAILABLE
+
+#include <app/server/Server.h>
+
+using namespace ::chip;
+
+CHIP_ERROR MrpAnalytics::AddListener(Messaging::ReliableMessageAnalyticsDelegate &listener)
+{
+	for (auto *&slot : mListeners) {
+		if (slot == nullptr) {
+			slot = &listener;
+
+			if (!mRegistered) {
+				Messaging::ReliableMessageMgr *manager =
+					Server::GetInstance().GetExchangeManager().GetReliableMessageMgr();
+
+				manager->RegisterAnalyticsDelegate(this);
+				mRegistered = true;
+			}
+
+			return CHIP_NO_ERROR;
+		}
+	}
+
+	return CHIP_ERROR_NO_MEMORY;
+}
+
+void MrpAnalytics::OnTransmitEvent(const TransmitEvent &event)
+{
+	for (auto *listener : mListeners) {
+		if (listener != nullptr) {
+			listener->OnTransmitEvent(event);
+		}
+	}
+}
+
+#endif /* APP_MRP_ANALYTICS_AVAILABLE */
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+
+/* The MRP transmissions are reported by the reliable messaging layer of the Matter libraries that support it. */
+#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED && __has_include(<messaging/ReliableMessageAnalyticsDelegate.h>)
+#include <messaging/ReliableMessageAnalyticsDelegate.h>
+#define APP_MRP_ANALYTICS_AVAILABLE 1
+#else
+#define APP_MRP_ANALYTICS_AVAILABLE 0
+#endif
+
+#if APP_MRP_ANALYTICS_AVAILABLE
+/*
+ * The reliable messaging layer accepts a single analytics delegate. This one is registered in its place and forwards
+ * the transmit events to every module that needs them: the radio statistics and the adaptive MRP intervals.
+ */
+class MrpAnalytics : public chip::Messaging::ReliableMessageAnalyticsDelegate {
+public:
+	static MrpAnalytics &Instance()
+	{
+		static MrpAnalytics sMrpAnalytics;
+		return sMrpAnalytics;
+	}
+
+	CHIP_ERROR AddListener(chip::Messaging::ReliableMessageAnalyticsDelegate &listener);
+
+	/* chip::Messaging::ReliableMessageAnalyticsDelegate */
+	void OnTransmitEvent(const TransmitEvent &event) override;
+
+private:
+	static constexpr size_t kMaxListeners = 2;
+
+	chip::Messaging::ReliableMessageAnalyticsDelegate *mListeners[kMaxListeners]{};
+	bool mRegistered{ false };
+};
+#endif /* APP_MRP_ANALYTICS_AVAILABLE */
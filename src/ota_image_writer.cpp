@@ -0,0 +1,476 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "ota_image_writer.h"
+
+#include <zephyr/drivers/flash.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/random/random.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/util.h>
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+K_THREAD_STACK_DEFINE(sOtaImageWriterStack, CONFIG_APP_OTA_WRITER_STACK_SIZE);
+
+namespace {
+
+uint32_t ElapsedUs(uint32_t startCycles)
+{
+	return k_cyc_to_us_floor32(k_cycle_get_32() - startCycles);
+}
+
+} /* namespace */
+
+int OtaImageWriter::Verify(uint8_t areaId, size_t size, const uint8_t *digest)
+{
+	const struct flash_area *area;
+	uint8_t computed[chip::Crypto::kSHA256_Hash_Length];
+	chip::MutableByteSpan computedSpan(computed);
+	uint8_t *chunk = mBuffers[0].mData;
+	int err;
+
+	if (mArea != nullptr) {
+		return -EBUSY;
+	}
+
+	mVerifiedOffset = 0;
+
+	err = flash_area_open(areaId, &area);
+	if (err) {
+		return err;
+	}
+
+	if (size > area->fa_size || mHash.Begin() != CHIP_NO_ERROR) {
+		flash_area_close(area);
+		return -EINVAL;
+	}
+
+	for (size_t offset = 0; offset < size; offset += sizeof(mBuffers[0].mData)) {
+		size_t chunkSize = MIN(size - offset, sizeof(mBuffers[0].mData));
+
+		err = flash_area_read(area, offset, chunk, chunkSize);
+		if (err) {
+			flash_area_close(area);
+			return err;
+		}
+
+		mHash.AddData(chip::ByteSpan(chunk, chunkSize));
+	}
+
+	flash_area_close(area);
+
+	if (mHash.GetDigest(computedSpan) != CHIP_NO_ERROR ||
+	    memcmp(computed, digest, chip::Crypto::kSHA256_Hash_Length) != 0) {
+		return -EILSEQ;
+	}
+
+	mVerifiedArea = areaId;
+	mVerifiedOffset = size;
+
+	return 0;
+}
+
+int OtaImageWriter::Open(uint8_t areaId, size_t imageSize, size_t startOffset)
+{
+	const struct flash_area *area;
+	struct flash_pages_info info;
+	int err;
+
+	if (mArea != nullptr) {
+		return -EBUSY;
+	}
+
+	err = flash_area_open(areaId, &area);
+	if (err) {
+		return err;
+	}
+
+	err = flash_get_page_info_by_offs(flash_area_get_device(area), area->fa_off, &info);
+	if (err || imageSize > area->fa_size || startOffset % info.size != 0 || startOffset > imageSize ||
+	    (startOffset != 0 && (areaId != mVerifiedArea || startOffset != mVerifiedOffset))) {
+		flash_area_close(area);
+		return err ? err : -EINVAL;
+	}
+
+	/* The hash state left by Verify() already covers the data before startOffset. */
+	if (startOffset == 0 && mHash.Begin() != CHIP_NO_ERROR) {
+		flash_area_close(area);
+		return -EIO;
+	}
+	mVerifiedOffset = 0;
+
+	if (!mThreadStarted) {
+		k_msgq_init(&mProgramQueue, mProgramQueueStorage, sizeof(uint8_t), ARRAY_SIZE(mBuffers));
+		k_sem_init(&mWork, 0, 1);
+		k_mutex_init(&mLock);
+		k_thread_create(&mThread, sOtaImageWriterStack, K_THREAD_STACK_SIZEOF(sOtaImageWriterStack),
+				ThreadMain, this, nullptr, nullptr, K_PRIO_PREEMPT(CONFIG_APP_OTA_WRITER_THREAD_PRIORITY),
+				0, K_NO_WAIT);
+		k_thread_name_set(&mThread, "ota_writer");
+		mThreadStarted = true;
+	}
+
+	k_mutex_lock(&mLock, K_FOREVER);
+
+	/* One buffer is being filled, the other one is free. */
+	k_sem_init(&mFreeBuffers, 1, 1);
+	k_msgq_purge(&mProgramQueue);
+
+	mPageSize = info.size;
+	mImageEnd = ROUND_UP(imageSize, mPageSize);
+	mWriteOffset = startOffset;
+	mErasedOffset = startOffset;
+	mCommittedOffset = startOffset;
+	mReportedOffset = startOffset;
+	mError = 0;
+	mFill = 0;
+	mBuffers[mFill].mOffset = startOffset;
+	mBuffers[mFill].mSize = 0;
+	memset(&mStats, 0, sizeof(mStats));
+	mArea = area;
+
+	k_mutex_unlock(&mLock);
+
+	/* Start erasing right away, the first block usually takes a while to arrive. */
+	k_sem_give(&mWork);
+
+	return 0;
+}
+
+int OtaImageWriter::Write(const uint8_t *data, size_t size)
+{
+	if (mArea == nullptr) {
+		return -EINVAL;
+	}
+
+	while (size > 0) {
+		Buffer &buffer = mBuffers[mFill];
+		size_t chunk = MIN(size, sizeof(buffer.mData) - buffer.mSize);
+
+		if (mError) {
+			return mError;
+		}
+
+		if (buffer.mOffset + buffer.mSize + chunk > mArea->fa_size) {
+			return -EFBIG;
+		}
+
+		memcpy(buffer.mData + buffer.mSize, data, chunk);
+		buffer.mSize += chunk;
+		data += chunk;
+		size -= chunk;
+
+		if (buffer.mSize == sizeof(buffer.mData)) {
+			int err = Submit();
+
+			if (err) {
+				return err;
+			}
+		}
+	}
+
+	return 0;
+}
+
+int OtaImageWriter::Submit()
+{
+	Buffer &buffer = mBuffers[mFill];
+	uint8_t index = mFill;
+	size_t nextOffset = buffer.mOffset + buffer.mSize;
+	uint32_t start;
+
+	k_msgq_put(&mProgramQueue, &index, K_NO_WAIT);
+	mWriteOffset = nextOffset;
+	k_sem_give(&mWork);
+
+	/* Blocks only if the writer thread has not finished programming the other buffer yet. */
+	start = k_cycle_get_32();
+	k_sem_take(&mFreeBuffers, K_FOREVER);
+	mStats.mStallUs += ElapsedUs(start);
+
+	mFill ^= 1;
+	mBuffers[mFill].mOffset = nextOffset;
+	mBuffers[mFill].mSize = 0;
+
+	return mError;
+}
+
+int OtaImageWriter::Close(bool success)
+{
+	int err;
+
+	if (mArea == nullptr) {
+		return 0;
+	}
+
+	if (success && mBuffers[mFill].mSize > 0) {
+		Submit();
+	}
+
+	/* Both buffers are free once the writer thread has drained the queue. */
+	k_sem_take(&mFreeBuffers, K_FOREVER);
+	k_sem_give(&mFreeBuffers);
+
+	k_mutex_lock(&mLock, K_FOREVER);
+	err = mError;
+	flash_area_close(mArea);
+	mArea = nullptr;
+	k_mutex_unlock(&mLock);
+
+	LOG_INF("OTA writer: %u B committed, erase %u ms, program %u ms, stalled %u ms",
+		static_cast<unsigned>(mCommittedOffset), mStats.mEraseUs / USEC_PER_MSEC,
+		mStats.mProgramUs / USEC_PER_MSEC, mStats.mStallUs / USEC_PER_MSEC);
+
+	return success ? err : 0;
+}
+
+void OtaImageWriter::ThreadMain(void *arg1, void *, void *)
+{
+	static_cast<OtaImageWriter *>(arg1)->Run();
+}
+
+bool OtaImageWriter::EraseNeeded(size_t untilOffset) const
+{
+	return mErasedOffset < MIN(untilOffset, mImageEnd);
+}
+
+int OtaImageWriter::EraseNext()
+{
+	uint32_t start = k_cycle_get_32();
+	int err = flash_area_erase(mArea, mErasedOffset, mPageSize);
+
+	mStats.mEraseUs += ElapsedUs(start);
+	mStats.mErasedPages++;
+	mErasedOffset += mPageSize;
+
+	return err;
+}
+
+int OtaImageWriter::Program(Buffer &buffer)
+{
+	size_t size = ROUND_UP(buffer.mSize, flash_area_align(mArea));
+	uint32_t start;
+	int err;
+
+	/* Pad the last, partially filled buffer to the write block size with the erased value. */
+	memset(buffer.mData + buffer.mSize, 0xff, size - buffer.mSize);
+
+	while (EraseNeeded(buffer.mOffset + size)) {
+		err = EraseNext();
+		if (err) {
+			return err;
+		}
+	}
+
+	start = k_cycle_get_32();
+	err = flash_area_write(mArea, buffer.mOffset, buffer.mData, size);
+	mStats.mProgramUs += ElapsedUs(start);
+	mStats.mProgrammedBuffers++;
+
+	return err;
+}
+
+bool OtaImageWriter::Step()
+{
+	uint8_t index;
+	int err;
+
+	if (k_msgq_peek(&mProgramQueue, &index) == 0) {
+		Buffer &buffer = mBuffers[index];
+
+		err = mError ? mError : Program(buffer);
+		if (err && !mError) {
+			LOG_ERR("OTA writer: failed to program 0x%x: %d", static_cast<unsigned>(buffer.mOffset), err);
+			mError = err;
+		}
+
+		if (!mError) {
+			mHash.AddData(chip::ByteSpan(buffer.mData, buffer.mSize));
+		}
+
+		mCommittedOffset = buffer.mOffset + buffer.mSize;
+		k_msgq_get(&mProgramQueue, &index, K_NO_WAIT);
+		k_sem_give(&mFreeBuffers);
+
+		/* Only page boundaries are reported, so a write can always be continued without erasing written data. */
+		if (!mError && mProgressCallback && mCommittedOffset % mPageSize == 0 &&
+		    mCommittedOffset - mReportedOffset >= CONFIG_APP_OTA_WRITER_PROGRESS_INTERVAL) {
+			uint8_t digest[chip::Crypto::kSHA256_Hash_Length];
+			chip::MutableByteSpan digestSpan(digest);
+
+			if (mHash.GetDigest(digestSpan) == CHIP_NO_ERROR) {
+				mReportedOffset = mCommittedOffset;
+				mProgressCallback(mReportedOffset, digest);
+			}
+		}
+
+		return true;
+	}
+
+	/* Nothing to program, use the time to erase the pages ahead of the incoming data. */
+	if (!mError && EraseNeeded(mWriteOffset + CONFIG_APP_OTA_WRITER_ERASE_AHEAD)) {
+		err = EraseNext();
+		if (err) {
+			LOG_ERR("OTA writer: failed to erase 0x%x: %d", static_cast<unsigned>(mErasedOffset - mPageSize),
+				err);
+			mError = err;
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+void OtaImageWriter::Run()
+{
+	while (true) {
+		bool busy = true;
+
+		k_sem_take(&mWork, K_FOREVER);
+
+		/* The lock is released between flash operations, so that Close() can tear the write down. */
+		while (busy) {
+			k_mutex_lock(&mLock, K_FOREVER);
+			busy = mArea != nullptr && Step();
+			k_mutex_unlock(&mLock);
+		}
+	}
+}
+
+#ifdef CONFIG_SHELL
+namespace {
+
+constexpr size_t kBenchBlockSize = 1024;
+
+/*
+ * Writes the given amount of data the way a stream writer erasing on demand does: each page is erased right before
+ * the first block landing in it is programmed, all on the calling thread.
+ */
+int BenchInterleaved(const struct flash_area *area, size_t pageSize, size_t total, const uint8_t *block)
+{
+	for (size_t offset = 0; offset < total; offset += kBenchBlockSize) {
+		int err;
+
+		if (offset % pageSize == 0) {
+			err = flash_area_erase(area, offset, pageSize);
+			if (err) {
+				return err;
+			}
+		}
+
+		err = flash_area_write(area, offset, block, kBenchBlockSize);
+		if (err) {
+			return err;
+		}
+	}
+
+	return 0;
+}
+
+int BenchPipelined(uint8_t areaId, size_t total, const uint8_t *block)
+{
+	OtaImageWriter &writer = OtaImageWriter::Instance();
+	int err;
+
+	/* Do not let the benchmark data pass for a partially downloaded image. */
+	writer.SetProgressCallback(nullptr);
+	err = writer.Open(areaId, total);
+
+	for (size_t offset = 0; !err && offset < total; offset += kBenchBlockSize) {
+		err = writer.Write(block, kBenchBlockSize);
+	}
+
+	return writer.Close(err == 0) ?: err;
+}
+
+int OtaWriterBenchHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	static uint8_t sBlock[kBenchBlockSize];
+	const uint8_t areaId = FIXED_PARTITION_ID(mcuboot_secondary);
+	size_t total = (argc > 1 ? strtoul(argv[1], nullptr, 10) : 256) * 1024;
+	const struct flash_area *area;
+	struct flash_pages_info info;
+	int64_t start;
+	int64_t interleavedMs;
+	int64_t pipelinedMs;
+	int err;
+
+	if (OtaImageWriter::Instance().IsBusy()) {
+		shell_error(shell, "An image is being written");
+		return -EBUSY;
+	}
+
+	err = flash_area_open(areaId, &area);
+	if (err) {
+		shell_error(shell, "Cannot open the secondary slot: %d", err);
+		return err;
+	}
+
+	flash_get_page_info_by_offs(flash_area_get_device(area), area->fa_off, &info);
+	total = MIN(ROUND_UP(total, info.size), area->fa_size);
+	sys_rand_get(sBlock, sizeof(sBlock));
+
+	shell_print(shell, "Writing %u KiB in %u B blocks, page size %u B", static_cast<unsigned>(total / 1024),
+		    static_cast<unsigned>(kBenchBlockSize), static_cast<unsigned>(info.size));
+
+	start = k_uptime_get();
+	err = BenchInterleaved(area, info.size, total, sBlock);
+	interleavedMs = MAX(k_uptime_get() - start, 1);
+	flash_area_close(area);
+
+	if (err) {
+		shell_error(shell, "Interleaved write failed: %d", err);
+		return err;
+	}
+
+	start = k_uptime_get();
+	err = BenchPipelined(areaId, total, sBlock);
+	pipelinedMs = MAX(k_uptime_get() - start, 1);
+
+	if (err) {
+		shell_error(shell, "Pipelined write failed: %d", err);
+		return err;
+	}
+
+	shell_print(shell, "interleaved: %lld ms, %lld B/s", interleavedMs, total * MSEC_PER_SEC / interleavedMs);
+	shell_print(shell, "pipelined:   %lld ms, %lld B/s, caller stalled %u ms", pipelinedMs,
+		    total * MSEC_PER_SEC / pipelinedMs, OtaImageWriter::Instance().GetStats().mStallUs / USEC_PER_MSEC);
+	shell_warn(shell, "The secondary slot has been overwritten");
+
+	return 0;
+}
+
+int OtaWriterStatsHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	const OtaImageWriter::Stats &stats = OtaImageWriter::Instance().GetStats();
+
+	shell_print(shell, "committed: %u B", static_cast<unsigned>(OtaImageWriter::Instance().CommittedOffset()));
+	shell_print(shell, "erase: %u pages, %u ms", stats.mErasedPages, stats.mEraseUs / USEC_PER_MSEC);
+	shell_print(shell, "program: %u buffers, %u ms", stats.mProgrammedBuffers, stats.mProgramUs / USEC_PER_MSEC);
+	shell_print(shell, "caller stalled: %u ms", stats.mStallUs / USEC_PER_MSEC);
+
+	return 0;
+}
+
+} /* namespace */
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_ota_writer,
+			       SHELL_CMD_ARG(stats, NULL, "Print statistics of the last image write",
+					     OtaWriterStatsHandler, 1, 0),
+			       SHELL_CMD_ARG(bench, NULL,
+					     "Compare interleaved and pipelined writes to the secondary slot "
+					     "(destroys its content). Usage: bench [KiB]",
+					     OtaWriterBenchHandler, 1, 1),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((app), ota_writer, &sub_ota_writer, "OTA image writer", NULL, 1, 0);
+#endif /* CONFIG_SHELL */
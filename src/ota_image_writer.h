@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <crypto/CHIPCryptoPAL.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/storage/flash_map.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Writes an image into a flash area without stalling the caller on flash operations.
+ *
+ * Incoming data is collected in one of two buffers. A full buffer is handed over to a dedicated writer thread, which
+ * programs it while the caller fills the other one. The writer thread also erases the flash pages ahead of the write
+ * offset whenever it has no buffer to program, so by the time data arrives its page is usually erased already. The
+ * caller only blocks when both buffers are waiting to be programmed.
+ *
+ * The writer keeps a SHA-256 hash of the data committed so far. Every CONFIG_APP_OTA_WRITER_PROGRESS_INTERVAL bytes
+ * the committed offset and the hash of the data before it are reported through a callback, which allows persisting
+ * them. An interrupted write can be continued after the persisted hash has been checked with Verify().
+ */
+class OtaImageWriter {
+public:
+	using ProgressCallback = void (*)(size_t committedOffset, const uint8_t *digest);
+
+	struct Stats {
+		uint32_t mEraseUs;
+		uint32_t mProgramUs;
+		uint32_t mStallUs;
+		uint32_t mErasedPages;
+		uint32_t mProgrammedBuffers;
+	};
+
+	static OtaImageWriter &Instance()
+	{
+		static OtaImageWriter sOtaImageWriter;
+		return sOtaImageWriter;
+	}
+
+	/*
+	 * Checks that the SHA-256 hash of the first size bytes of the flash area matches the given digest. On success,
+	 * the next Open() may continue the write from that offset.
+	 */
+	int Verify(uint8_t areaId, size_t size, const uint8_t *digest);
+	/*
+	 * Starts writing an image of the given size to the flash area. A non-zero startOffset continues a write up to
+	 * the offset checked by the last Verify() call.
+	 */
+	int Open(uint8_t areaId, size_t imageSize, size_t startOffset = 0);
+	int Write(const uint8_t *data, size_t size);
+	/* Flushes the remaining data and waits until it is committed to flash. */
+	int Close(bool success);
+
+	bool IsBusy() const { return mArea != nullptr; }
+	void SetProgressCallback(ProgressCallback callback) { mProgressCallback = callback; }
+	size_t CommittedOffset() const { return mCommittedOffset; }
+	const Stats &GetStats() const { return mStats; }
+
+private:
+	struct Buffer {
+		uint8_t mData[CONFIG_APP_OTA_WRITER_BUFFER_SIZE] __aligned(4);
+		size_t mOffset;
+		size_t mSize;
+	};
+
+	static void ThreadMain(void *arg1, void *arg2, void *arg3);
+
+	int Submit();
+	void Run();
+	bool Step();
+	int Program(Buffer &buffer);
+	int EraseNext();
+	bool EraseNeeded(size_t untilOffset) const;
+
+	const struct flash_area *mArea{ nullptr };
+	size_t mPageSize{ 0 };
+	size_t mImageEnd{ 0 };
+	size_t mWriteOffset{ 0 };
+	size_t mErasedOffset{ 0 };
+	volatile size_t mCommittedOffset{ 0 };
+	size_t mReportedOffset{ 0 };
+	volatile int mError{ 0 };
+	bool mThreadStarted{ false };
+
+	Buffer mBuffers[2];
+	uint8_t mFill{ 0 };
+	/* Buffers waiting to be programmed, in order, and the number of buffers available for filling. */
+	struct k_msgq mProgramQueue;
+	char mProgramQueueStorage[2 * sizeof(uint8_t)];
+	struct k_sem mFreeBuffers;
+	struct k_sem mWork;
+	struct k_mutex mLock;
+	struct k_thread mThread;
+
+	chip::Crypto::Hash_SHA256_stream mHash;
+	uint8_t mVerifiedArea{ 0 };
+	size_t mVerifiedOffset{ 0 };
+
+	ProgressCallback mProgressCallback{ nullptr };
+	Stats mStats{};
+};
@@ -0,0 +1,426 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "ota_payload_decoder.h"
+
+#include <crypto/CHIPCryptoPAL.h>
+
+#ifdef CONFIG_APP_OTA_COMPRESSION
+#include <nrf_compress/implementation.h>
+#endif
+
+#include <zephyr/logging/log.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/byteorder.h>
+
+#include <errno.h>
+#include <string.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+namespace {
+
+constexpr uint8_t kHeaderVersion = 1;
+constexpr size_t kMagicSize = sizeof(uint32_t);
+constexpr size_t kBaseChunkSize = 256;
+
+#ifdef CONFIG_APP_OTA_COMPRESSION
+struct nrf_compress_implementation *sLzma;
+#endif
+
+} /* namespace */
+
+int OtaPayloadDecoder::Open(uint8_t areaId, size_t payloadSize, OtaImageWriter::ProgressCallback progressCallback)
+{
+	if (mOpen) {
+		return -EBUSY;
+	}
+
+	mAreaId = areaId;
+	mPayloadSize = payloadSize;
+	mProgressCallback = progressCallback;
+	mReceived = 0;
+	mPassThrough = false;
+	mHeaderSize = 0;
+	mImageWritten = 0;
+	mDeltaState = DeltaState::kOpcode;
+#ifdef CONFIG_APP_OTA_COMPRESSION
+	mInputSize = 0;
+#endif
+	memset(&mStats, 0, sizeof(mStats));
+	mStats.mPayloadSize = payloadSize;
+	mOpen = true;
+
+	return 0;
+}
+
+int OtaPayloadDecoder::Write(const uint8_t *data, size_t size)
+{
+	uint32_t start = k_cycle_get_32();
+	int err = 0;
+
+	if (!mOpen) {
+		return -EINVAL;
+	}
+
+	mReceived += size;
+
+	if (!mPassThrough && mHeaderSize < sizeof(mHeader)) {
+		err = ParseHeader(data, size);
+	}
+
+	if (!err && size > 0) {
+		if (mPassThrough) {
+			err = OtaImageWriter::Instance().Write(data, size);
+		} else if (mHeader.mFlags & kFlagCompressed) {
+			err = Decompress(data, size);
+		} else {
+			err = Decode(data, size);
+		}
+	}
+
+	mStats.mDecodeUs += k_cyc_to_us_floor32(k_cycle_get_32() - start);
+
+	return err;
+}
+
+int OtaPayloadDecoder::ParseHeader(const uint8_t *&data, size_t &size)
+{
+	uint8_t *header = reinterpret_cast<uint8_t *>(&mHeader);
+	size_t chunk = MIN(size, sizeof(mHeader) - mHeaderSize);
+
+	memcpy(header + mHeaderSize, data, chunk);
+	mHeaderSize += chunk;
+	data += chunk;
+	size -= chunk;
+
+	if (mHeaderSize < kMagicSize) {
+		return 0;
+	}
+
+	/* Anything else than the decoder header is an MCUboot image, write it out including the bytes taken so far. */
+	if (sys_le32_to_cpu(mHeader.mMagic) != kMagic) {
+		int err;
+
+		mPassThrough = true;
+		OtaImageWriter::Instance().SetProgressCallback(mProgressCallback);
+		err = OtaImageWriter::Instance().Open(mAreaId, mPayloadSize);
+
+		return err ? err : OtaImageWriter::Instance().Write(header, mHeaderSize);
+	}
+
+	if (mHeaderSize < sizeof(mHeader)) {
+		return 0;
+	}
+
+	return OpenImage();
+}
+
+int OtaPayloadDecoder::OpenImage()
+{
+	int err;
+
+	mHeader.mImageSize = sys_le32_to_cpu(mHeader.mImageSize);
+	mHeader.mBaseSize = sys_le32_to_cpu(mHeader.mBaseSize);
+	mStats.mImageSize = mHeader.mImageSize;
+
+	if (mHeader.mVersion != kHeaderVersion) {
+		LOG_ERR("OTA payload: unsupported version %u", mHeader.mVersion);
+		return -ENOTSUP;
+	}
+
+#ifndef CONFIG_APP_OTA_COMPRESSION
+	if (mHeader.mFlags & kFlagCompressed) {
+		LOG_ERR("OTA payload: compressed payloads are not supported");
+		return -ENOTSUP;
+	}
+#endif
+#ifndef CONFIG_APP_OTA_DELTA
+	if (mHeader.mFlags & kFlagDelta) {
+		LOG_ERR("OTA payload: delta payloads are not supported");
+		return -ENOTSUP;
+	}
+#endif
+
+	if (mHeader.mFlags & kFlagDelta) {
+		err = VerifyBase();
+		if (err) {
+			return err;
+		}
+	}
+
+#ifdef CONFIG_APP_OTA_COMPRESSION
+	if (mHeader.mFlags & kFlagCompressed) {
+		sLzma = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZMA);
+		if (sLzma == nullptr) {
+			return -ENOTSUP;
+		}
+
+		err = sLzma->init(nullptr, mHeader.mImageSize);
+		if (err) {
+			return err;
+		}
+	}
+#endif
+
+	LOG_INF("OTA payload: %s%s image of %u B", (mHeader.mFlags & kFlagCompressed) ? "compressed " : "",
+		(mHeader.mFlags & kFlagDelta) ? "delta" : "full", mHeader.mImageSize);
+
+	/* The decoder state cannot be restored, so a decoded image is always written from the beginning. */
+	OtaImageWriter::Instance().SetProgressCallback(nullptr);
+
+	return OtaImageWriter::Instance().Open(mAreaId, mHeader.mImageSize);
+}
+
+int OtaPayloadDecoder::VerifyBase()
+{
+	uint8_t chunk[kBaseChunkSize];
+	uint8_t digest[chip::Crypto::kSHA256_Hash_Length];
+	chip::MutableByteSpan digestSpan(digest);
+	chip::Crypto::Hash_SHA256_stream hash;
+	int err;
+
+	err = flash_area_open(FIXED_PARTITION_ID(mcuboot_primary), &mBaseArea);
+	if (err) {
+		return err;
+	}
+
+	if (mHeader.mBaseSize > mBaseArea->fa_size || hash.Begin() != CHIP_NO_ERROR) {
+		return -EINVAL;
+	}
+
+	for (size_t offset = 0; offset < mHeader.mBaseSize; offset += sizeof(chunk)) {
+		size_t chunkSize = MIN(mHeader.mBaseSize - offset, sizeof(chunk));
+
+		err = flash_area_read(mBaseArea, offset, chunk, chunkSize);
+		if (err) {
+			return err;
+		}
+
+		hash.AddData(chip::ByteSpan(chunk, chunkSize));
+	}
+
+	if (hash.Finish(digestSpan) != CHIP_NO_ERROR || memcmp(digest, mHeader.mBaseDigest, sizeof(digest)) != 0) {
+		LOG_ERR("OTA payload: the delta was made for a different image");
+		return -EILSEQ;
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_APP_OTA_COMPRESSION
+int OtaPayloadDecoder::Decompress(const uint8_t *data, size_t size)
+{
+	while (size > 0) {
+		size_t chunkSize = MIN(sLzma->decompress_bytes_needed(nullptr), sizeof(mInput));
+		size_t chunk = chunkSize > mInputSize ? MIN(chunkSize - mInputSize, size) : 0;
+		bool last;
+		size_t used = 0;
+
+		memcpy(mInput + mInputSize, data, chunk);
+		mInputSize += chunk;
+		data += chunk;
+		size -= chunk;
+
+		last = mReceived == mPayloadSize && size == 0;
+		if (mInputSize < chunkSize && !last) {
+			break;
+		}
+
+		/* Feed the decompressor with whole chunks, only the final one may be shorter. */
+		while (used < mInputSize) {
+			uint32_t consumed = 0;
+			uint8_t *output = nullptr;
+			size_t outputSize = 0;
+			int err = sLzma->decompress(nullptr, mInput + used, mInputSize - used, last, &consumed, &output,
+						    &outputSize);
+
+			if (err) {
+				LOG_ERR("OTA payload: decompression failed: %d", err);
+				return err;
+			}
+
+			if (outputSize > 0) {
+				err = Decode(output, outputSize);
+				if (err) {
+					return err;
+				}
+			}
+
+			if (consumed == 0 && outputSize == 0) {
+				break;
+			}
+
+			used += consumed;
+		}
+
+		if (used == 0 && chunk == 0) {
+			LOG_ERR("OTA payload: decompressor stalled");
+			return -EIO;
+		}
+
+		memmove(mInput, mInput + used, mInputSize - used);
+		mInputSize -= used;
+	}
+
+	return 0;
+}
+#else
+int OtaPayloadDecoder::Decompress(const uint8_t *data, size_t size)
+{
+	return -ENOTSUP;
+}
+#endif /* CONFIG_APP_OTA_COMPRESSION */
+
+int OtaPayloadDecoder::Decode(const uint8_t *data, size_t size)
+{
+	return (mHeader.mFlags & kFlagDelta) ? ApplyDelta(data, size) : Output(data, size);
+}
+
+int OtaPayloadDecoder::ApplyDelta(const uint8_t *data, size_t size)
+{
+	while (size > 0) {
+		size_t chunk;
+		int err;
+
+		switch (mDeltaState) {
+		case DeltaState::kOpcode:
+			mOpcode = *data++;
+			size--;
+
+			if (mOpcode != kDeltaCopy && mOpcode != kDeltaInsert) {
+				LOG_ERR("OTA payload: invalid delta operation 0x%02x", mOpcode);
+				return -EILSEQ;
+			}
+
+			mArgumentsSize = 0;
+			mDeltaState = DeltaState::kArguments;
+			break;
+
+		case DeltaState::kArguments: {
+			size_t needed = mOpcode == kDeltaCopy ? 2 * sizeof(uint32_t) : sizeof(uint32_t);
+
+			chunk = MIN(needed - mArgumentsSize, size);
+			memcpy(mArguments + mArgumentsSize, data, chunk);
+			mArgumentsSize += chunk;
+			data += chunk;
+			size -= chunk;
+
+			if (mArgumentsSize < needed) {
+				break;
+			}
+
+			if (mOpcode == kDeltaCopy) {
+				err = CopyFromBase(sys_get_le32(mArguments), sys_get_le32(mArguments + sizeof(uint32_t)));
+				if (err) {
+					return err;
+				}
+				mDeltaState = DeltaState::kOpcode;
+			} else {
+				mInsertRemaining = sys_get_le32(mArguments);
+				mDeltaState = mInsertRemaining ? DeltaState::kInsert : DeltaState::kOpcode;
+			}
+			break;
+		}
+
+		case DeltaState::kInsert:
+			chunk = MIN(mInsertRemaining, size);
+			err = Output(data, chunk);
+			if (err) {
+				return err;
+			}
+
+			mInsertRemaining -= chunk;
+			data += chunk;
+			size -= chunk;
+
+			if (mInsertRemaining == 0) {
+				mDeltaState = DeltaState::kOpcode;
+			}
+			break;
+		}
+	}
+
+	return 0;
+}
+
+int OtaPayloadDecoder::CopyFromBase(uint32_t offset, uint32_t length)
+{
+	uint8_t chunk[kBaseChunkSize];
+
+	if (offset > mHeader.mBaseSize || length > mHeader.mBaseSize - offset) {
+		LOG_ERR("OTA payload: delta copy out of the base image");
+		return -EILSEQ;
+	}
+
+	mStats.mCopiedBytes += length;
+
+	while (length > 0) {
+		size_t chunkSize = MIN(length, sizeof(chunk));
+		int err = flash_area_read(mBaseArea, offset, chunk, chunkSize);
+
+		if (!err) {
+			err = Output(chunk, chunkSize);
+		}
+
+		if (err) {
+			return err;
+		}
+
+		offset += chunkSize;
+		length -= chunkSize;
+	}
+
+	return 0;
+}
+
+int OtaPayloadDecoder::Output(const uint8_t *data, size_t size)
+{
+	if (size > mHeader.mImageSize - mImageWritten) {
+		LOG_ERR("OTA payload: decoded data exceeds the image size");
+		return -EFBIG;
+	}
+
+	mImageWritten += size;
+
+	return OtaImageWriter::Instance().Write(data, size);
+}
+
+int OtaPayloadDecoder::Close(bool success)
+{
+	int err = 0;
+
+	if (!mOpen) {
+		return 0;
+	}
+
+	if (success && !mPassThrough && (mHeaderSize < sizeof(mHeader) || mImageWritten != mHeader.mImageSize)) {
+		LOG_ERR("OTA payload: decoded %u B of %u B", static_cast<unsigned>(mImageWritten), mHeader.mImageSize);
+		err = -EILSEQ;
+	}
+
+#ifdef CONFIG_APP_OTA_COMPRESSION
+	if (!mPassThrough && (mHeader.mFlags & kFlagCompressed) && sLzma != nullptr) {
+		sLzma->deinit(nullptr);
+		sLzma = nullptr;
+	}
+#endif
+
+	if (mBaseArea != nullptr) {
+		flash_area_close(mBaseArea);
+		mBaseArea = nullptr;
+	}
+
+	err = OtaImageWriter::Instance().Close(success && !err) ?: err;
+	mOpen = false;
+
+	if (!mPassThrough) {
+		LOG_INF("OTA payload: %u B decoded into %u B (%u B copied from the base) in %u ms", mStats.mPayloadSize,
+			static_cast<unsigned>(mImageWritten), mStats.mCopiedBytes, mStats.mDecodeUs / USEC_PER_MSEC);
+	}
+
+	return success ? err : 0;
+}
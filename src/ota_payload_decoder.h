@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include "ota_image_writer.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Turns the application image payload of an OTA package into the image written to the secondary slot.
+ *
+ * A payload starting with the MCUboot image header is written as is. A payload produced by scripts/ota_payload.py
+ * starts with the header below and is decoded on the fly: an LZMA2 compressed payload is decompressed, a delta
+ * payload is applied to the image in the primary slot, and both can be combined. The decoded data is passed to
+ * OtaImageWriter in the order it is produced, so RAM usage does not depend on the image size.
+ *
+ * The delta is a sequence of operations, each starting with a one byte opcode followed by 32-bit little endian
+ * arguments:
+ *   kDeltaCopy (offset, length):   copies length bytes of the base image starting at offset,
+ *   kDeltaInsert (length, data[]): inserts length bytes following the operation.
+ */
+class OtaPayloadDecoder {
+public:
+	static constexpr uint32_t kMagic = 0x41544f41; /* "AOTA" */
+	static constexpr uint8_t kFlagCompressed = BIT(0);
+	static constexpr uint8_t kFlagDelta = BIT(1);
+	static constexpr uint8_t kDeltaCopy = 0x01;
+	static constexpr uint8_t kDeltaInsert = 0x02;
+
+	struct __packed Header {
+		uint32_t mMagic;
+		uint8_t mVersion;
+		uint8_t mFlags;
+		uint16_t mReserved;
+		uint32_t mImageSize;
+		uint32_t mBaseSize;
+		uint8_t mBaseDigest[32];
+	};
+
+	struct Stats {
+		uint32_t mPayloadSize;
+		uint32_t mImageSize;
+		uint32_t mCopiedBytes;
+		uint32_t mDecodeUs;
+	};
+
+	static OtaPayloadDecoder &Instance()
+	{
+		static OtaPayloadDecoder sOtaPayloadDecoder;
+		return sOtaPayloadDecoder;
+	}
+
+	/*
+	 * Starts decoding a payload of the given size into the flash area. The progress callback is passed to the
+	 * writer for payloads written as is; decoded payloads cannot be resumed, so their progress is not reported.
+	 */
+	int Open(uint8_t areaId, size_t payloadSize, OtaImageWriter::ProgressCallback progressCallback);
+	int Write(const uint8_t *data, size_t size);
+	int Close(bool success);
+
+	const Stats &GetStats() const { return mStats; }
+
+private:
+	enum class DeltaState : uint8_t { kOpcode, kArguments, kInsert };
+
+	int ParseHeader(const uint8_t *&data, size_t &size);
+	int Decompress(const uint8_t *data, size_t size);
+	int Decode(const uint8_t *data, size_t size);
+	int ApplyDelta(const uint8_t *data, size_t size);
+	int CopyFromBase(uint32_t offset, uint32_t length);
+	int Output(const uint8_t *data, size_t size);
+	int OpenImage();
+	int VerifyBase();
+
+	uint8_t mAreaId{ 0 };
+	size_t mPayloadSize{ 0 };
+	size_t mReceived{ 0 };
+	bool mOpen{ false };
+	bool mPassThrough{ false };
+	OtaImageWriter::ProgressCallback mProgressCallback{ nullptr };
+
+	Header mHeader{};
+	size_t mHeaderSize{ 0 };
+	size_t mImageWritten{ 0 };
+	const struct flash_area *mBaseArea{ nullptr };
+
+	DeltaState mDeltaState{ DeltaState::kOpcode };
+	uint8_t mOpcode{ 0 };
+	uint8_t mArguments[2 * sizeof(uint32_t)];
+	size_t mArgumentsSize{ 0 };
+	uint32_t mInsertRemaining{ 0 };
+
+#ifdef CONFIG_APP_OTA_COMPRESSION
+	uint8_t mInput[CONFIG_APP_OTA_DECOMPRESSION_CHUNK_SIZE];
+	size_t mInputSize{ 0 };
+#endif
+
+	Stats mStats{};
+};
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "ota_requestor.h"
+#include "ota_image_writer.h"
+#include "ota_payload_decoder.h"
+
+#include "dfu/ota/ota_util.h"
+
+#include <app/server/Server.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/OTAImageHeader.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <dfu/dfu_multi_image.h>
+#include <dfu/dfu_target.h>
+#include <dfu/dfu_target_mcuboot.h>
+#include <zephyr/dfu/mcuboot.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/storage/flash_map.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+using namespace ::chip::DeviceLayer;
+
+namespace {
+
+constexpr int kAppImageId = 0;
+constexpr uint8_t kAppImageArea = FIXED_PARTITION_ID(mcuboot_secondary);
+constexpr char kProgressKey[] = "app/ota/progress";
+
+/*
+ * Identity of the image being downloaded and the part of it committed to the secondary slot. The OTA image digest
+ * from the Matter OTA header identifies the image, the hash of the committed data is used to check that the slot
+ * has not been modified since.
+ */
+struct Progress {
+	uint32_t mSoftwareVersion;
+	uint32_t mPayloadSize;
+	uint32_t mAppImageSize;
+	uint8_t mImageDigest[Crypto::kSHA256_Hash_Length];
+	uint32_t mCommittedOffset;
+	uint8_t mCommittedDigest[Crypto::kSHA256_Hash_Length];
+};
+
+/* Written on the Matter thread before the image is opened, then only updated by the writer thread. */
+Progress sProgress;
+
+void SaveProgress(size_t committedOffset, const uint8_t *digest)
+{
+	int err;
+
+	sProgress.mCommittedOffset = committedOffset;
+	memcpy(sProgress.mCommittedDigest, digest, sizeof(sProgress.mCommittedDigest));
+
+	err = settings_save_one(kProgressKey, &sProgress, sizeof(sProgress));
+	if (err) {
+		LOG_WRN("Failed to store OTA progress: %d", err);
+	}
+}
+
+#ifdef CONFIG_APP_OTA_RESUME
+int LoadProgressCallback(const char *key, size_t length, settings_read_cb readCb, void *cbArg, void *param)
+{
+	if (length != sizeof(Progress)) {
+		return -EINVAL;
+	}
+
+	return readCb(cbArg, param, length) == sizeof(Progress) ? 0 : -EIO;
+}
+
+bool LoadProgress(Progress &progress)
+{
+	memset(&progress, 0, sizeof(progress));
+
+	return settings_load_subtree_direct(kProgressKey, LoadProgressCallback, &progress) == 0 &&
+	       progress.mCommittedOffset != 0;
+}
+#endif
+
+int OpenAppImage(int imageId, size_t imageSize)
+{
+	sProgress.mAppImageSize = imageSize;
+
+	return OtaPayloadDecoder::Instance().Open(kAppImageArea, imageSize, SaveProgress);
+}
+
+int WriteAppImage(const uint8_t *chunk, size_t chunkSize)
+{
+	return OtaPayloadDecoder::Instance().Write(chunk, chunkSize);
+}
+
+int CloseAppImage(bool success)
+{
+	/* The progress is kept after a failure, so that the next attempt can continue from it. */
+	return OtaPayloadDecoder::Instance().Close(success);
+}
+
+int OpenImage(int imageId, size_t imageSize)
+{
+	return dfu_target_init(DFU_TARGET_IMAGE_TYPE_MCUBOOT, imageId, imageSize, nullptr);
+}
+
+int WriteImage(const uint8_t *chunk, size_t chunkSize)
+{
+	return dfu_target_write(chunk, chunkSize);
+}
+
+int CloseImage(bool success)
+{
+	return success ? dfu_target_done(success) : dfu_target_reset();
+}
+
+} /* namespace */
+
+CHIP_ERROR OtaImageProcessor::PrepareDownload()
+{
+	VerifyOrReturnError(mDownloader != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+	return SystemLayer().ScheduleLambda([this] { mDownloader->OnPreparedForDownload(PrepareDownloadImpl()); });
+}
+
+CHIP_ERROR OtaImageProcessor::PrepareDownloadImpl()
+{
+	mHeaderParser.Init();
+	mParams = {};
+	mResuming = false;
+
+	if (mFlashHandler) {
+		mFlashHandler->DoAction(ExternalFlashManager::Action::WAKE_UP);
+	}
+
+	ReturnErrorOnFailure(System::MapErrorZephyr(dfu_target_mcuboot_set_buf(mBuffer, sizeof(mBuffer))));
+	ReturnErrorOnFailure(System::MapErrorZephyr(dfu_multi_image_init(mBuffer, sizeof(mBuffer))));
+
+	for (int imageId = 0; imageId < CONFIG_UPDATEABLE_IMAGE_NUMBER; ++imageId) {
+		dfu_image_writer writer;
+
+		writer.image_id = imageId;
+		writer.open = imageId == kAppImageId ? OpenAppImage : OpenImage;
+		writer.write = imageId == kAppImageId ? WriteAppImage : WriteImage;
+		writer.close = imageId == kAppImageId ? CloseAppImage : CloseImage;
+
+		ReturnErrorOnFailure(System::MapErrorZephyr(dfu_multi_image_register_writer(&writer)));
+	}
+
+	return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OtaImageProcessor::DecodeHeader(ByteSpan &block, bool &decoded)
+{
+	OTAImageHeader header;
+	CHIP_ERROR error;
+
+	decoded = false;
+	VerifyOrReturnError(mHeaderParser.IsInitialized(), CHIP_NO_ERROR);
+
+	error = mHeaderParser.AccumulateAndDecode(block, header);
+	VerifyOrReturnError(error != CHIP_ERROR_BUFFER_TOO_SMALL, CHIP_NO_ERROR);
+	ReturnErrorOnFailure(error);
+
+	mParams.totalFileBytes = header.mPayloadSize;
+
+	memset(&sProgress, 0, sizeof(sProgress));
+	sProgress.mSoftwareVersion = header.mSoftwareVersion;
+	sProgress.mPayloadSize = static_cast<uint32_t>(header.mPayloadSize);
+	memcpy(sProgress.mImageDigest, header.mImageDigest.data(),
+	       MIN(header.mImageDigest.size(), sizeof(sProgress.mImageDigest)));
+
+	mHeaderParser.Clear();
+	decoded = true;
+
+	return CHIP_NO_ERROR;
+}
+
+/*
+ * Called once the OTA image header has been decoded. Returns the number of payload bytes to skip, or zero if the
+ * download starts from the beginning.
+ */
+size_t OtaImageProcessor::StartResume(size_t receivedPayload)
+{
+#ifdef CONFIG_APP_OTA_RESUME
+	Progress stored;
+	size_t resumeOffset;
+	int err;
+
+	if (!LoadProgress(stored)) {
+		return 0;
+	}
+
+	if (stored.mSoftwareVersion != sProgress.mSoftwareVersion || stored.mPayloadSize != sProgress.mPayloadSize ||
+	    memcmp(stored.mImageDigest, sProgress.mImageDigest, sizeof(stored.mImageDigest)) != 0 ||
+	    stored.mAppImageSize > stored.mPayloadSize) {
+		LOG_INF("OTA: a different image is downloaded, dropping the partial one");
+		settings_delete(kProgressKey);
+		return 0;
+	}
+
+	/* A single-image package is the package header followed by the application image. */
+	resumeOffset = stored.mPayloadSize - stored.mAppImageSize + stored.mCommittedOffset;
+	if (resumeOffset <= receivedPayload) {
+		return 0;
+	}
+
+	err = OtaImageWriter::Instance().Verify(kAppImageArea, stored.mCommittedOffset, stored.mCommittedDigest);
+	if (!err) {
+		OtaImageWriter::Instance().SetProgressCallback(SaveProgress);
+		err = OtaImageWriter::Instance().Open(kAppImageArea, stored.mAppImageSize, stored.mCommittedOffset);
+	}
+
+	if (err) {
+		LOG_WRN("OTA: the partial image cannot be used: %d", err);
+		settings_delete(kProgressKey);
+		return 0;
+	}
+
+	LOG_INF("OTA: resuming the download at %u/%u", static_cast<unsigned>(resumeOffset),
+		static_cast<unsigned>(stored.mPayloadSize));
+
+	sProgress = stored;
+	mResuming = true;
+	mParams.downloadedBytes = resumeOffset;
+
+	return resumeOffset - receivedPayload;
+#else
+	settings_delete(kProgressKey);
+	return 0;
+#endif
+}
+
+CHIP_ERROR OtaImageProcessor::ProcessBlock(ByteSpan &block)
+{
+	VerifyOrReturnError(mDownloader != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+	bool headerDecoded;
+	size_t skip = 0;
+	CHIP_ERROR error = DecodeHeader(block, headerDecoded);
+
+	if (error == CHIP_NO_ERROR && headerDecoded) {
+		skip = StartResume(block.size());
+	}
+
+	if (error == CHIP_NO_ERROR && skip == 0) {
+		if (mResuming) {
+			error = System::MapErrorZephyr(OtaImageWriter::Instance().Write(block.data(), block.size()));
+		} else {
+			error = System::MapErrorZephyr(
+				dfu_multi_image_write(mParams.downloadedBytes, block.data(), block.size()));
+		}
+		mParams.downloadedBytes += block.size();
+	}
+
+	return SystemLayer().ScheduleLambda([this, error, skip] {
+		if (error != CHIP_NO_ERROR) {
+			mDownloader->EndDownload(error);
+		} else if (skip != 0) {
+			mDownloader->SkipData(static_cast<uint32_t>(skip));
+		} else {
+			mDownloader->FetchNextData();
+		}
+	});
+}
+
+CHIP_ERROR OtaImageProcessor::Finalize()
+{
+	if (mResuming) {
+		mResuming = false;
+		return System::MapErrorZephyr(OtaImageWriter::Instance().Close(true));
+	}
+
+	return OTAImageProcessorImpl::Finalize();
+}
+
+CHIP_ERROR OtaImageProcessor::Abort()
+{
+	if (mResuming) {
+		mResuming = false;
+		OtaImageWriter::Instance().Close(false);
+	}
+
+	return OTAImageProcessorImpl::Abort();
+}
+
+CHIP_ERROR OtaImageProcessor::Apply()
+{
+	/* The application image bypasses the DFU target library, so it has to be marked for the upgrade here. */
+	ReturnErrorOnFailure(System::MapErrorZephyr(boot_request_upgrade_multi(kAppImageId, BOOT_UPGRADE_TEST)));
+	settings_delete(kProgressKey);
+
+	return OTAImageProcessorImpl::Apply();
+}
+
+void OtaRequestor::Install()
+{
+	/*
+	 * The common sample code only creates its requestor if no requestor instance is set, so installing this one
+	 * before the Matter server starts leaves a single requestor, driver and BDX downloader in the application.
+	 */
+	SetRequestorInstance(&mRequestor);
+}
+
+CHIP_ERROR OtaRequestor::Init()
+{
+#if CONFIG_PM_DEVICE && CONFIG_NORDIC_QSPI_NOR
+	static OtaImageProcessor sImageProcessor(&Nrf::GetFlashHandler());
+#else
+	static OtaImageProcessor sImageProcessor;
+#endif
+
+	VerifyOrReturnError(GetRequestorInstance() == &mRequestor, CHIP_ERROR_INCORRECT_STATE);
+
+	sImageProcessor.SetOTADownloader(&mDownloader);
+	mDownloader.SetImageProcessorDelegate(&sImageProcessor);
+	mStorage.Init(Server::GetInstance().GetPersistentStorage());
+	ReturnErrorOnFailure(mRequestor.Init(Server::GetInstance(), mStorage, mDriver, mDownloader));
+	mDriver.Init(&mRequestor, &sImageProcessor);
+
+#ifdef CONFIG_APP_OTA_RESUME
+	Progress stored;
+
+	/* Do not wait for the periodic query to pick up the interrupted download. */
+	if (LoadProgress(stored)) {
+		LOG_INF("OTA: found a partial image of version %u, %u B committed",
+			static_cast<unsigned>(stored.mSoftwareVersion), static_cast<unsigned>(stored.mCommittedOffset));
+		ReturnErrorOnFailure(SystemLayer().StartTimer(
+			System::Clock::Seconds32(CONFIG_APP_OTA_RESUME_QUERY_DELAY_S),
+			[](System::Layer *, void *) { GetRequestorInstance()->TriggerImmediateQueryInternal(); },
+			nullptr));
+	}
+#endif
+
+	return CHIP_NO_ERROR;
+}
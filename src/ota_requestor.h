@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <app/clusters/ota-requestor/BDXDownloader.h>
+#include <app/clusters/ota-requestor/DefaultOTARequestor.h>
+#include <app/clusters/ota-requestor/DefaultOTARequestorDriver.h>
+#include <app/clusters/ota-requestor/DefaultOTARequestorStorage.h>
+#include <lib/core/CHIPError.h>
+#include <platform/nrfconnect/OTAImageProcessorImpl.h>
+
+/*
+ * OTA image processor writing the application image through OtaImageWriter instead of the DFU target stream, so that
+ * flash erase and program operations no longer run on the Matter thread between BDX blocks. Images of other cores
+ * included in the multi-image package still go through the DFU target library.
+ *
+ * With CONFIG_APP_OTA_RESUME, a download of the image that was being downloaded before continues from the last
+ * committed offset: the data received so far is checked against the stored hash and the rest of the BDX transfer
+ * is requested with a skip. The resumed data is passed to OtaImageWriter directly, as the multi-image parser cannot
+ * start in the middle of a package.
+ */
+class OtaImageProcessor : public chip::DeviceLayer::OTAImageProcessorImpl {
+public:
+	using OTAImageProcessorImpl::OTAImageProcessorImpl;
+
+	CHIP_ERROR PrepareDownload() override;
+	CHIP_ERROR Finalize() override;
+	CHIP_ERROR Abort() override;
+	CHIP_ERROR Apply() override;
+	CHIP_ERROR ProcessBlock(chip::ByteSpan &block) override;
+
+private:
+	CHIP_ERROR PrepareDownloadImpl();
+	CHIP_ERROR DecodeHeader(chip::ByteSpan &block, bool &decoded);
+	size_t StartResume(size_t receivedPayload);
+
+	bool mResuming{ false };
+};
+
+/*
+ * OTA requestor using OtaImageProcessor, used instead of the requestor of the common sample code. Install() must be
+ * called before the Matter server is initialized, so that the common code finds a requestor instance and does not
+ * create its own, and Init() after it.
+ */
+class OtaRequestor {
+public:
+	static OtaRequestor &Instance()
+	{
+		static OtaRequestor sOtaRequestor;
+		return sOtaRequestor;
+	}
+
+	void Install();
+	CHIP_ERROR Init();
+
+private:
+	chip::BDXDownloader mDownloader;
+	chip::DefaultOTARequestor mRequestor;
+	chip::DefaultOTARequestorStorage mStorage;
+	chip::DeviceLayer::DefaultOTARequestorDriver mDriver;
+};
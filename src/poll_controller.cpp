@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "poll_controller.h"
+
+#include <app/icd/server/ICDConfigurationData.h>
+#include <app/server/Server.h>
+#include <matter/tracing/build_config.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <protocols/interaction_model/Constants.h>
+#include <tracing/registry.h>
+#include <transport/TracingStructs.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/shell/shell.h>
+
+#if !MATTER_TRACING_ENABLED
+#error "CONFIG_APP_POLL_CONTROLLER requires the Matter library to be built with tracing support"
+#endif
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+using namespace ::chip::Tracing;
+
+namespace {
+
+constexpr PollPolicy::Config kPollPolicyConfig = { CONFIG_APP_POLL_FAST_INTERVAL_MS,
+						   CONFIG_APP_POLL_MIN_SLOW_INTERVAL_MS,
+						   CONFIG_APP_POLL_MAX_SLOW_INTERVAL_MS,
+						   CONFIG_APP_POLL_REPORT_WINDOW_MS,
+						   CONFIG_APP_POLL_ACK_TIMEOUT_MS };
+
+} /* namespace */
+
+PollController::PollController() : mPolicy(kPollPolicyConfig) {}
+
+CHIP_ERROR PollController::Init()
+{
+	Register(*this);
+	ReturnErrorOnFailure(Server::GetInstance().GetICDManager().RegisterObserver(this));
+	mIntervalSinceMs = k_uptime_get_32();
+	Evaluate();
+
+	return CHIP_NO_ERROR;
+}
+
+void PollController::OnSample(uint32_t nextSampleInMs, bool changed)
+{
+	/* The sample period is far below 2^31 ms, which leaves the lowest bit of the context word for the flag. */
+	uint32_t context = (nextSampleInMs << 1) | (changed ? 1 : 0);
+
+	DeviceLayer::PlatformMgr().ScheduleWork(SampleWork, static_cast<intptr_t>(context));
+}
+
+void PollController::SampleWork(intptr_t context)
+{
+	PollController &controller = Instance();
+	uint32_t value = static_cast<uint32_t>(context);
+
+	controller.mPolicy.OnSample(k_uptime_get_32(), value >> 1, value & 1);
+	controller.Evaluate();
+}
+
+void PollController::LogMessageSend(MessageSendInfo &info)
+{
+	if (info.messageType != OutgoingMessageType::kSecureSession) {
+		return;
+	}
+
+	if (info.payloadHeader->HasMessageType(Protocols::InteractionModel::MsgType::ReportData)) {
+		mPolicy.OnReportSent();
+	}
+
+	if (info.payloadHeader->NeedsAck()) {
+		mPolicy.OnAckExpected(k_uptime_get_32());
+	}
+
+	Evaluate();
+}
+
+void PollController::LogMessageReceived(MessageReceivedInfo &info)
+{
+	if (info.messageType != IncomingMessageType::kSecureUnicast ||
+	    !info.payloadHeader->GetAckMessageCounter().HasValue()) {
+		return;
+	}
+
+	mPolicy.OnAckReceived();
+	Evaluate();
+}
+
+void PollController::OnEnterActiveMode()
+{
+	mIcdActive = true;
+	Evaluate(true);
+}
+
+void PollController::OnEnterIdleMode()
+{
+	mIcdActive = false;
+	Evaluate(true);
+}
+
+void PollController::OnICDModeChange()
+{
+	Evaluate(true);
+}
+
+void PollController::TimerHandler(System::Layer *layer, void *context)
+{
+	static_cast<PollController *>(context)->Evaluate();
+}
+
+void PollController::Account(uint32_t nowMs)
+{
+	uint32_t elapsed = nowMs - mIntervalSinceMs;
+
+	mIntervalSinceMs = nowMs;
+
+	if (mInterval == 0) {
+		return;
+	}
+
+	/* Carry the part of a poll interval elapsed so far, so that short segments are not lost. */
+	uint64_t fraction = mPollFraction + (static_cast<uint64_t>(elapsed) << 16) / mInterval;
+
+	mPolls += fraction >> 16;
+	mPollFraction = static_cast<uint32_t>(fraction & UINT16_MAX);
+
+	if (mInterval <= CONFIG_APP_POLL_FAST_INTERVAL_MS) {
+		mFastMs += elapsed;
+	} else {
+		mSlowMs += elapsed;
+	}
+}
+
+void PollController::Evaluate(bool force)
+{
+	uint32_t now = k_uptime_get_32();
+	uint32_t interval = mPolicy.Interval(now);
+
+	DeviceLayer::SystemLayer().CancelTimer(TimerHandler, this);
+	DeviceLayer::SystemLayer().StartTimer(System::Clock::Milliseconds32(MAX(mPolicy.NextEvaluationInMs(now), 1)),
+					      TimerHandler, this);
+
+	if (mIcdActive) {
+		interval = MIN(interval, ICDConfigurationData::GetInstance().GetFastPollingInterval().count());
+	}
+
+	/* The ICD manager has just set its own period, which must be overridden even if ours did not change. */
+	if (interval == mInterval && !force) {
+		return;
+	}
+
+	Account(now);
+	mInterval = interval;
+	mChanges++;
+
+	CHIP_ERROR err = DeviceLayer::ConnectivityMgr().SetPollingInterval(System::Clock::Milliseconds32(interval));
+
+	if (err != CHIP_NO_ERROR) {
+		LOG_ERR("Failed to set the poll period: %" CHIP_ERROR_FORMAT, err.Format());
+	}
+}
+
+#ifdef CONFIG_SHELL
+void PollController::Print(const struct shell *shell)
+{
+	Account(k_uptime_get_32());
+
+	/* The baseline polls at a fixed period, so its count follows from the total time. */
+	uint64_t baselinePolls = (mFastMs + mSlowMs) / CONFIG_APP_POLL_BASELINE_INTERVAL_MS;
+	uint64_t radioOnUs = mPolls * CONFIG_APP_POLL_RADIO_ON_US;
+	uint64_t baselineRadioOnUs = baselinePolls * CONFIG_APP_POLL_RADIO_ON_US;
+
+	shell_print(shell, "current interval: %u ms, changes: %u, ICD %s mode", mInterval, mChanges,
+		    mIcdActive ? "active" : "idle");
+	shell_print(shell, "fast: %llu ms, slow: %llu ms", mFastMs, mSlowMs);
+	shell_print(shell, "polls: %llu (fixed %u ms period: %llu)", mPolls, CONFIG_APP_POLL_BASELINE_INTERVAL_MS,
+		    baselinePolls);
+	shell_print(shell, "estimated radio-on: %llu ms (fixed period: %llu ms)", radioOnUs / USEC_PER_MSEC,
+		    baselineRadioOnUs / USEC_PER_MSEC);
+}
+
+static int PollControllerShowHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::StackLock lock;
+
+	PollController::Instance().Print(shell);
+	return 0;
+}
+
+SHELL_SUBCMD_ADD((app), poll, NULL, "Print poll controller statistics", PollControllerShowHandler, 1, 0);
+#endif /* CONFIG_SHELL */
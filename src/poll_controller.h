@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include "poll_policy.h"
+
+#include <app/icd/server/ICDStateObserver.h>
+#include <system/SystemLayer.h>
+#include <tracing/backend.h>
+
+struct shell;
+
+/*
+ * Drives the Thread poll period from PollPolicy. Outgoing reports and messages awaiting an acknowledgement are
+ * observed through the Matter tracing backend interface, sensor samples are signalled by the sensor thread.
+ * The module also estimates the number of polls and the radio-on time compared to polling with a fixed period.
+ *
+ * The ICD manager sets the poll period as well when the ICD operating mode changes. The controller observes these
+ * transitions and sets the period itself right after the ICD manager: while the ICD is in active mode the period
+ * never exceeds the ICD fast polling interval, in idle mode the policy decides.
+ */
+class PollController : public chip::Tracing::Backend, public chip::app::ICDStateObserver {
+public:
+	static PollController &Instance()
+	{
+		static PollController sPollController;
+		return sPollController;
+	}
+
+	CHIP_ERROR Init();
+	void Print(const struct shell *shell);
+
+	/*
+	 * Thread-safe, called by the sensor thread after every sample. The report window is only opened if the sample
+	 * changed a MeasuredValue attribute.
+	 */
+	void OnSample(uint32_t nextSampleInMs, bool changed);
+
+	/* chip::Tracing::Backend */
+	void LogMessageSend(chip::Tracing::MessageSendInfo &info) override;
+	void LogMessageReceived(chip::Tracing::MessageReceivedInfo &info) override;
+
+	/* chip::app::ICDStateObserver */
+	void OnEnterActiveMode() override;
+	void OnEnterIdleMode() override;
+	void OnTransitionToIdle() override {}
+	void OnICDModeChange() override;
+
+private:
+	PollController();
+
+	static void SampleWork(intptr_t context);
+	static void TimerHandler(chip::System::Layer *layer, void *context);
+
+	void Evaluate(bool force = false);
+	void Account(uint32_t nowMs);
+
+	PollPolicy mPolicy;
+	bool mIcdActive{ false };
+	uint32_t mInterval{ 0 };
+	uint32_t mIntervalSinceMs{ 0 };
+	uint64_t mPolls{ 0 };
+	/* Fraction of the next poll already elapsed, in 1/65536 of the poll interval. */
+	uint32_t mPollFraction{ 0 };
+	uint64_t mFastMs{ 0 };
+	uint64_t mSlowMs{ 0 };
+	uint32_t mChanges{ 0 };
+};
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * Thread poll period policy. The device polls its parent fast only while it expects incoming frames (a report that
+ * is about to be generated or an acknowledgement for a message it has sent). Otherwise the poll period is stretched
+ * up to the next sensor sample, so that the poll coincides with the moment the device wakes up anyway.
+ *
+ * The policy only operates on timestamps passed by the caller and has no dependencies on the platform.
+ */
+class PollPolicy {
+public:
+	struct Config {
+		uint32_t mFastIntervalMs;
+		uint32_t mMinSlowIntervalMs;
+		uint32_t mMaxSlowIntervalMs;
+		/* How long after a sample a report is expected to be generated and acknowledged. */
+		uint32_t mReportWindowMs;
+		/* How long an acknowledgement is waited for before the exchange is considered finished. */
+		uint32_t mAckTimeoutMs;
+	};
+
+	explicit PollPolicy(const Config &config) : mConfig(config) {}
+
+	/* A report is only expected if the sample changed a reported value. */
+	void OnSample(uint32_t nowMs, uint32_t nextSampleInMs, bool changed)
+	{
+		mNextSampleMs = nowMs + nextSampleInMs;
+
+		if (changed) {
+			mReportDeadlineMs = nowMs + mConfig.mReportWindowMs;
+			mReportExpected = true;
+		}
+	}
+
+	void OnAckExpected(uint32_t nowMs)
+	{
+		mOutstandingAcks++;
+		mAckDeadlineMs = nowMs + mConfig.mAckTimeoutMs;
+	}
+
+	void OnAckReceived()
+	{
+		if (mOutstandingAcks > 0) {
+			mOutstandingAcks--;
+		}
+	}
+
+	void OnReportSent() { mReportExpected = false; }
+
+	bool IsFast(uint32_t nowMs)
+	{
+		if (mReportExpected && Elapsed(nowMs, mReportDeadlineMs)) {
+			mReportExpected = false;
+		}
+
+		if (mOutstandingAcks > 0 && Elapsed(nowMs, mAckDeadlineMs)) {
+			mOutstandingAcks = 0;
+		}
+
+		return mReportExpected || mOutstandingAcks > 0;
+	}
+
+	/* Poll interval to use now. */
+	uint32_t Interval(uint32_t nowMs)
+	{
+		if (IsFast(nowMs)) {
+			return mConfig.mFastIntervalMs;
+		}
+
+		uint32_t untilSample = Elapsed(nowMs, mNextSampleMs) ? 0 : mNextSampleMs - nowMs;
+
+		if (untilSample < mConfig.mMinSlowIntervalMs) {
+			return mConfig.mMinSlowIntervalMs;
+		}
+
+		return untilSample > mConfig.mMaxSlowIntervalMs ? mConfig.mMaxSlowIntervalMs : untilSample;
+	}
+
+	/* Time after which the interval returned by Interval() may change. */
+	uint32_t NextEvaluationInMs(uint32_t nowMs)
+	{
+		if (!IsFast(nowMs)) {
+			return Interval(nowMs);
+		}
+
+		/* Fast polling lasts until both the report window and the acknowledgement timeout are over. */
+		uint32_t deadline = mReportExpected ? mReportDeadlineMs : mAckDeadlineMs;
+
+		if (mReportExpected && mOutstandingAcks > 0 && Elapsed(mAckDeadlineMs, mReportDeadlineMs)) {
+			deadline = mAckDeadlineMs;
+		}
+
+		return Elapsed(nowMs, deadline) ? 0 : deadline - nowMs;
+	}
+
+private:
+	/* Wrap-around safe check whether the deadline has passed. */
+	static bool Elapsed(uint32_t nowMs, uint32_t deadlineMs) { return static_cast<int32_t>(nowMs - deadlineMs) >= 0; }
+
+	Config mConfig;
+	uint32_t mNextSampleMs{ 0 };
+	uint32_t mReportDeadlineMs{ 0 };
+	uint32_t mAckDeadlineMs{ 0 };
+	uint32_t mOutstandingAcks{ 0 };
+	bool mReportExpected{ false };
+};
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "pool_stats.h"
+
+#include <app/InteractionModelEngine.h>
+#include <app/server/Server.h>
+#include <lib/core/CHIPConfig.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <system/SystemConfig.h>
+#include <system/SystemStats.h>
+
+#include <zephyr/logging/log.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/util.h>
+
+#include <string.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+using namespace ::chip::app;
+
+#if !CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+#error "Pool statistics require CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS"
+#endif
+
+namespace {
+
+struct PoolInfo {
+	const char *mMacro;
+	uint16_t mSize;
+	/* Index in the Matter system statistics, or -1 if the pool is sampled. */
+	int mStatsIndex;
+};
+
+constexpr PoolInfo kPools[PoolStats::kPoolCount] = {
+	{ "CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS", CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS,
+	  System::Stats::kExchangeMgr_NumContexts },
+	{ "CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS", CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS,
+	  System::Stats::kExchangeMgr_NumUMHandlers },
+	{ "CHIP_SYSTEM_CONFIG_NUM_TIMERS", CHIP_SYSTEM_CONFIG_NUM_TIMERS, System::Stats::kSystemLayer_NumTimers },
+	{ "CHIP_CONFIG_SECURE_SESSION_POOL_SIZE", CHIP_CONFIG_SECURE_SESSION_POOL_SIZE, -1 },
+	{ "CHIP_IM_MAX_NUM_READS", CHIP_IM_MAX_NUM_READS, -1 },
+	{ "CHIP_IM_MAX_NUM_SUBSCRIPTIONS", CHIP_IM_MAX_NUM_SUBSCRIPTIONS, -1 },
+	{ "CHIP_IM_MAX_NUM_WRITE_HANDLER", CHIP_IM_MAX_NUM_WRITE_HANDLER, -1 },
+};
+
+uint16_t CountSecureSessions()
+{
+	uint16_t count = 0;
+
+	Server::GetInstance().GetSecureSessionManager().GetSecureSessions().ForEachSession([&count](auto *session) {
+		count++;
+		return Loop::Continue;
+	});
+
+	return count;
+}
+
+} /* namespace */
+
+CHIP_ERROR PoolStats::Init()
+{
+	Reset();
+
+	return DeviceLayer::SystemLayer().StartTimer(
+		System::Clock::Milliseconds32(CONFIG_APP_POOL_STATS_SAMPLE_PERIOD_MS), SampleTimerHandler, this);
+}
+
+void PoolStats::Reset()
+{
+	System::Stats::count_t *inUse = System::Stats::GetResourcesInUse();
+	System::Stats::count_t *peaks = System::Stats::GetHighWatermarks();
+
+	/* The Matter statistics have no reset, restart their watermarks from the current usage. */
+	for (int i = 0; i < System::Stats::kNumEntries; i++) {
+		peaks[i] = inUse[i];
+	}
+
+	memset(mUsage, 0, sizeof(mUsage));
+	Sample();
+}
+
+void PoolStats::Sample()
+{
+	InteractionModelEngine *engine = InteractionModelEngine::GetInstance();
+	const System::Stats::count_t *inUse = System::Stats::GetResourcesInUse();
+	const System::Stats::count_t *peaks = System::Stats::GetHighWatermarks();
+
+	for (size_t i = 0; i < ARRAY_SIZE(kPools); i++) {
+		if (kPools[i].mStatsIndex >= 0) {
+			mUsage[i].mCurrent = inUse[kPools[i].mStatsIndex];
+			mUsage[i].mPeak = peaks[kPools[i].mStatsIndex];
+		}
+	}
+
+	mUsage[kSecureSessions].mCurrent = CountSecureSessions();
+	mUsage[kReadInteractions].mCurrent = engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Read);
+	mUsage[kSubscriptions].mCurrent = engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe);
+	mUsage[kWriteHandlers].mCurrent = engine->GetNumActiveWriteHandlers();
+
+	for (Usage &usage : mUsage) {
+		usage.mPeak = MAX(usage.mPeak, usage.mCurrent);
+	}
+}
+
+void PoolStats::SampleTimerHandler(System::Layer *layer, void *context)
+{
+	PoolStats *self = static_cast<PoolStats *>(context);
+
+	self->Sample();
+	layer->StartTimer(System::Clock::Milliseconds32(CONFIG_APP_POOL_STATS_SAMPLE_PERIOD_MS), SampleTimerHandler,
+			  self);
+}
+
+#ifdef CONFIG_SHELL
+void PoolStats::Print(const struct shell *shell)
+{
+	Sample();
+
+	shell_print(shell, "%-45s %-7s %-5s %-5s", "pool", "current", "peak", "size");
+
+	for (size_t i = 0; i < ARRAY_SIZE(kPools); i++) {
+		shell_print(shell, "%-45s %-7u %-5u %-5u", kPools[i].mMacro, mUsage[i].mCurrent, mUsage[i].mPeak,
+			    kPools[i].mSize);
+
+		if (mUsage[i].mPeak >= kPools[i].mSize) {
+			shell_warn(shell, "%s: exhausted, the peak is a lower bound", kPools[i].mMacro);
+		}
+	}
+}
+
+static int PoolStatsShowHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::StackLock lock;
+
+	PoolStats::Instance().Print(shell);
+	return 0;
+}
+
+static int PoolStatsResetHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::StackLock lock;
+
+	PoolStats::Instance().Reset();
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_pool_stats,
+			       SHELL_CMD_ARG(show, NULL, "Print the current and peak usage of the Matter pools",
+					     PoolStatsShowHandler, 1, 0),
+			       SHELL_CMD_ARG(reset, NULL, "Reset the peak usage of the Matter pools", PoolStatsResetHandler,
+					     1, 0),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((app), pools, &sub_pool_stats, "Matter pool usage", NULL, 1, 0);
+#endif /* CONFIG_SHELL */
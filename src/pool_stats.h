@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <system/SystemLayer.h>
+
+#include <stdint.h>
+
+struct shell;
+
+/*
+ * Usage of the fixed size Matter object pools, tracked to size them for the workload of this application rather
+ * than using the upstream defaults. The pools counted by the Matter system statistics keep exact high watermarks,
+ * the others (secure sessions and interaction handlers) are sampled on the Matter thread every
+ * CONFIG_APP_POOL_STATS_SAMPLE_PERIOD_MS. The "app pools show" shell command prints the usage next to the configured
+ * size and the name of the configuration macro, which scripts/pool_config.py turns into overrides in
+ * chip_project_config.h.
+ */
+class PoolStats {
+public:
+	enum Pool : uint8_t {
+		kExchanges,
+		kUnsolicitedHandlers,
+		kTimers,
+		kSecureSessions,
+		kReadInteractions,
+		kSubscriptions,
+		kWriteHandlers,
+		kPoolCount
+	};
+
+	struct Usage {
+		uint16_t mCurrent;
+		uint16_t mPeak;
+	};
+
+	static PoolStats &Instance()
+	{
+		static PoolStats sPoolStats;
+		return sPoolStats;
+	}
+
+	CHIP_ERROR Init();
+	void Reset();
+	void Sample();
+	const Usage &Get(Pool pool) const { return mUsage[pool]; }
+	void Print(const struct shell *shell);
+
+private:
+	static void SampleTimerHandler(chip::System::Layer *layer, void *context);
+
+	Usage mUsage[kPoolCount];
+};
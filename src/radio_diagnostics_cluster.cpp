@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "radio_diagnostics_cluster.h"
+
+#ifdef CONFIG_APP_RADIO_STATS
+#include "radio_stats.h"
+#endif
+
+#include <app/AttributeAccessInterface.h>
+#include <app/AttributeAccessInterfaceRegistry.h>
+#include <app/data-model/Nullable.h>
+
+#include <zephyr/sys/util.h>
+
+using namespace ::chip;
+using namespace ::chip::app;
+
+namespace RadioDiagnostics {
+namespace {
+
+#ifdef CONFIG_APP_RADIO_STATS
+uint32_t ToMilliseconds(uint64_t us)
+{
+	return static_cast<uint32_t>(MIN(us / 1000, UINT32_MAX));
+}
+#endif
+
+class RadioAttrAccess : public AttributeAccessInterface {
+public:
+	RadioAttrAccess() : AttributeAccessInterface(MakeOptional(kRootEndpointId), kClusterId) {}
+
+	CHIP_ERROR Read(const ConcreteReadAttributePath &path, AttributeValueEncoder &encoder) override
+	{
+		if (path.mAttributeId > Attributes::kLastCauseAttribute) {
+			/* Global attributes are served from the attribute storage. */
+			return CHIP_NO_ERROR;
+		}
+
+		DataModel::Nullable<uint32_t> value;
+
+#ifdef CONFIG_APP_RADIO_STATS
+		RadioStats &stats = RadioStats::Instance();
+		RadioStats::Availability availability = RadioStats::GetAvailability();
+
+		/* Bring the counters up to date with the activity since the last periodic sample. */
+		stats.Sample();
+
+		if (path.mAttributeId >= Attributes::kFirstCauseAttribute) {
+			AttributeId offset = path.mAttributeId - Attributes::kFirstCauseAttribute;
+			const RadioStats::CauseStats &cause =
+				stats.Get(static_cast<RadioStats::Cause>(offset / Attributes::kAttributesPerCause));
+
+			bool available = availability.mRetransmissions ||
+					 offset / Attributes::kAttributesPerCause != RadioStats::kRetransmit;
+
+			if (!available) {
+				/* Leave the value null. */
+			} else if (offset % Attributes::kAttributesPerCause == 0) {
+				value.SetNonNull(cause.mEvents);
+			} else if (availability.mRadioOn) {
+				value.SetNonNull(ToMilliseconds(cause.mRadio.mRadioOnUs));
+			}
+		} else {
+			RadioStats::Counters totals = stats.GetTotals();
+
+			switch (path.mAttributeId) {
+			case Attributes::kTxFrames:
+				value.SetNonNull(totals.mTxFrames);
+				break;
+			case Attributes::kRxFrames:
+				value.SetNonNull(totals.mRxFrames);
+				break;
+			case Attributes::kTxRetries:
+				if (availability.mRetries) {
+					value.SetNonNull(totals.mTxRetries);
+				}
+				break;
+			case Attributes::kTxBytes:
+				value.SetNonNull(totals.mTxBytes);
+				break;
+			case Attributes::kRxBytes:
+				value.SetNonNull(totals.mRxBytes);
+				break;
+			case Attributes::kRadioOnTime:
+				if (availability.mRadioOn) {
+					value.SetNonNull(ToMilliseconds(totals.mRadioOnUs));
+				}
+				break;
+			default:
+				break;
+			}
+		}
+#endif
+		return encoder.Encode(value);
+	}
+};
+
+RadioAttrAccess sAttrAccess;
+
+} /* namespace */
+} /* namespace RadioDiagnostics */
+
+void MatterRadioDiagnosticsPluginServerInitCallback()
+{
+	AttributeAccessInterfaceRegistry::Instance().Register(&RadioDiagnostics::sAttrAccess);
+}
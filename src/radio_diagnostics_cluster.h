@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <lib/core/DataModelTypes.h>
+
+/*
+ * Manufacturer specific Radio Diagnostics cluster on endpoint 0, defined in
+ * src/default_zap/radio-diagnostics-cluster.xml. The attributes are read from RadioStats on demand and are null when
+ * CONFIG_APP_RADIO_STATS is disabled or the radio does not provide the counter.
+ */
+namespace RadioDiagnostics {
+
+inline constexpr chip::ClusterId kClusterId = 0xFFF1FC42;
+
+namespace Attributes {
+inline constexpr chip::AttributeId kTxFrames = 0x0000;
+inline constexpr chip::AttributeId kRxFrames = 0x0001;
+inline constexpr chip::AttributeId kTxRetries = 0x0002;
+inline constexpr chip::AttributeId kTxBytes = 0x0003;
+inline constexpr chip::AttributeId kRxBytes = 0x0004;
+inline constexpr chip::AttributeId kRadioOnTime = 0x0005;
+/* Events and radio-on time of each RadioStats cause, in the order of RadioStats::Cause. */
+inline constexpr chip::AttributeId kFirstCauseAttribute = 0x0006;
+inline constexpr chip::AttributeId kAttributesPerCause = 2;
+inline constexpr chip::AttributeId kLastCauseAttribute = 0x0011;
+} /* namespace Attributes */
+
+} /* namespace RadioDiagnostics */
@@ -0,0 +1,438 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "radio_stats.h"
+
+#include <app/server/Server.h>
+#include <matter/tracing/build_config.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <protocols/interaction_model/Constants.h>
+#include <tracing/registry.h>
+#include <transport/SecureSession.h>
+#include <transport/TracingStructs.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_mgmt.h>
+#include <zephyr/net/net_stats.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/util.h>
+
+#ifdef CONFIG_NET_L2_OPENTHREAD
+#include <openthread/link.h>
+#ifdef CONFIG_OPENTHREAD_RADIO_STATS
+#include <openthread/radio_stats.h>
+#endif
+#ifdef CONFIG_OPENTHREAD_SRP_CLIENT
+#include <openthread/srp_client.h>
+#endif
+#include <zephyr/net/openthread.h>
+#endif
+
+#include <string.h>
+
+#if !MATTER_TRACING_ENABLED
+#error "CONFIG_APP_RADIO_STATS requires the Matter library to be built with tracing support"
+#endif
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+using namespace ::chip::Tracing;
+using MsgType = ::chip::Protocols::InteractionModel::MsgType;
+
+namespace {
+
+constexpr const char *kCauseNames[RadioStats::kCauseCount] = { "report",	"poll",		 "retransmit",
+								"srp",		"commissioning", "other" };
+
+/* Order in which the causes active during a sample get its radio activity. */
+constexpr RadioStats::Cause kCausePriority[] = { RadioStats::kCommissioning, RadioStats::kRetransmit,
+						 RadioStats::kReport,	     RadioStats::kSrp,
+						 RadioStats::kPoll,	     RadioStats::kOther };
+
+/* MRP gives up on a message well before that, an entry older than this was never acknowledged. */
+constexpr uint32_t kPendingTimeoutMs = 30000;
+
+bool SrpUpdateInProgress()
+{
+#if defined(CONFIG_NET_L2_OPENTHREAD) && defined(CONFIG_OPENTHREAD_SRP_CLIENT)
+	struct openthread_context *context = openthread_get_default_context();
+	otSrpClientItemState state;
+
+	openthread_api_mutex_lock(context);
+	state = otSrpClientGetHostInfo(context->instance)->mState;
+	openthread_api_mutex_unlock(context);
+
+	return state != OT_SRP_CLIENT_ITEM_STATE_REGISTERED && state != OT_SRP_CLIENT_ITEM_STATE_REMOVED;
+#else
+	return false;
+#endif
+}
+
+void Accumulate(RadioStats::Counters &total, const RadioStats::Counters &delta)
+{
+	total.mTxFrames += delta.mTxFrames;
+	total.mRxFrames += delta.mRxFrames;
+	total.mTxRetries += delta.mTxRetries;
+	total.mTxBytes += delta.mTxBytes;
+	total.mRxBytes += delta.mRxBytes;
+	total.mRadioOnUs += delta.mRadioOnUs;
+}
+
+} /* namespace */
+
+CHIP_ERROR RadioStats::Init()
+{
+	Reset();
+
+	Register(*this);
+#if APP_MRP_ANALYTICS_AVAILABLE
+	ReturnErrorOnFailure(MrpAnalytics::Instance().AddListener(*this));
+#endif
+
+	return DeviceLayer::SystemLayer().StartTimer(
+		System::Clock::Milliseconds32(CONFIG_APP_RADIO_STATS_SAMPLE_PERIOD_MS), TimerHandler, this);
+}
+
+void RadioStats::Reset()
+{
+	memset(mCauses, 0, sizeof(mCauses));
+	memset(mPending, 0, sizeof(mPending));
+	mLatched = 0;
+	mPendingOverflows = 0;
+	mSrpInProgress = false;
+	mCommissioning = false;
+
+	if (!ReadSnapshot(mLast)) {
+		mLast = {};
+	}
+}
+
+bool RadioStats::ReadSnapshot(Snapshot &snapshot)
+{
+#if defined(CONFIG_NET_L2_OPENTHREAD)
+	struct openthread_context *context = openthread_get_default_context();
+	struct net_stats_bytes bytes = {};
+
+	if (!context) {
+		return false;
+	}
+
+	openthread_api_mutex_lock(context);
+
+	const otMacCounters *counters = otLinkGetCounters(context->instance);
+
+	snapshot.mRadio.mTxFrames = counters->mTxTotal;
+	snapshot.mRadio.mRxFrames = counters->mRxTotal;
+	snapshot.mRadio.mTxRetries = counters->mTxRetry;
+	snapshot.mPolls = counters->mTxDataPoll;
+#ifdef CONFIG_OPENTHREAD_RADIO_STATS
+	const otRadioTimeStats *time = otRadioTimeStatsGet(context->instance);
+
+	snapshot.mRadio.mRadioOnUs = time->mTxTime + time->mRxTime;
+#else
+	snapshot.mRadio.mRadioOnUs = 0;
+#endif
+
+	openthread_api_mutex_unlock(context);
+
+	if (net_mgmt(NET_REQUEST_STATS_GET_BYTES, net_if_get_default(), &bytes, sizeof(bytes)) == 0) {
+		snapshot.mRadio.mTxBytes = bytes.sent;
+		snapshot.mRadio.mRxBytes = bytes.received;
+	}
+
+	return true;
+#elif defined(CONFIG_WIFI_NRF70)
+	struct net_if *iface = net_if_get_first_wifi();
+	struct net_stats_wifi stats = {};
+
+	if (!iface || net_mgmt(NET_REQUEST_STATS_GET_WIFI, iface, &stats, sizeof(stats)) != 0) {
+		return false;
+	}
+
+	snapshot.mRadio = { stats.pkts.tx, stats.pkts.rx, 0, stats.bytes.sent, stats.bytes.received, 0 };
+	snapshot.mPolls = 0;
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+RadioStats::Availability RadioStats::GetAvailability()
+{
+	return { IS_ENABLED(CONFIG_NET_L2_OPENTHREAD),
+		 IS_ENABLED(CONFIG_NET_L2_OPENTHREAD) && IS_ENABLED(CONFIG_OPENTHREAD_RADIO_STATS),
+		 APP_MRP_ANALYTICS_AVAILABLE || IS_ENABLED(CONFIG_NET_L2_OPENTHREAD) };
+}
+
+uint8_t RadioStats::ActiveCauses()
+{
+	Server &server = Server::GetInstance();
+	uint32_t now = k_uptime_get_32();
+	uint8_t active = 0;
+	bool commissioning = server.GetFailSafeContext().IsFailSafeArmed() ||
+			     server.GetCommissioningWindowManager().IsCommissioningWindowOpen();
+	bool srp = SrpUpdateInProgress();
+
+	if (commissioning) {
+		active |= BIT(kCommissioning);
+		mCauses[kCommissioning].mEvents += !mCommissioning;
+	}
+
+	if (srp) {
+		active |= BIT(kSrp);
+		mCauses[kSrp].mEvents += !mSrpInProgress;
+	}
+
+	mCommissioning = commissioning;
+	mSrpInProgress = srp;
+
+	for (PendingMessage &message : mPending) {
+		if (message.mInUse && now - message.mSentMs >= kPendingTimeoutMs) {
+			message.mInUse = false;
+		}
+
+		if (!message.mInUse) {
+			continue;
+		}
+
+		if (message.mRetransmitted) {
+			active |= BIT(kRetransmit);
+		} else if (message.mReport) {
+			active |= BIT(kReport);
+		}
+	}
+
+	return active;
+}
+
+void RadioStats::Sample()
+{
+	Snapshot now{};
+
+	if (!ReadSnapshot(now)) {
+		return;
+	}
+
+	uint8_t active = ActiveCauses();
+	uint8_t causes = mLatched | active;
+	uint32_t polls = now.mPolls - mLast.mPolls;
+
+	if (polls > 0) {
+		causes |= BIT(kPoll);
+		mCauses[kPoll].mEvents += polls;
+	}
+
+#if !APP_MRP_ANALYTICS_AVAILABLE
+	/* The MRP retransmissions are not reported, the frames retried by the MAC stand for them. Always 0 on Wi-Fi. */
+	uint32_t retries = now.mRadio.mTxRetries - mLast.mRadio.mTxRetries;
+
+	if (retries > 0) {
+		causes |= BIT(kRetransmit);
+		mCauses[kRetransmit].mEvents += retries;
+	}
+#endif
+
+	Cause cause = kOther;
+
+	for (Cause candidate : kCausePriority) {
+		if (causes & BIT(candidate)) {
+			cause = candidate;
+			break;
+		}
+	}
+
+	/* The counters wrap around, the unsigned differences stay correct. */
+	Counters delta = { now.mRadio.mTxFrames - mLast.mRadio.mTxFrames,   now.mRadio.mRxFrames - mLast.mRadio.mRxFrames,
+			   now.mRadio.mTxRetries - mLast.mRadio.mTxRetries, now.mRadio.mTxBytes - mLast.mRadio.mTxBytes,
+			   now.mRadio.mRxBytes - mLast.mRadio.mRxBytes,	    now.mRadio.mRadioOnUs - mLast.mRadio.mRadioOnUs };
+
+	Accumulate(mCauses[cause].mRadio, delta);
+	mLast = now;
+	mLatched = active;
+}
+
+RadioStats::Counters RadioStats::GetTotals() const
+{
+	Counters totals{};
+
+	for (const CauseStats &cause : mCauses) {
+		Accumulate(totals, cause.mRadio);
+	}
+
+	return totals;
+}
+
+void RadioStats::TimerHandler(System::Layer *layer, void *context)
+{
+	RadioStats *self = static_cast<RadioStats *>(context);
+
+	self->Sample();
+	layer->StartTimer(System::Clock::Milliseconds32(CONFIG_APP_RADIO_STATS_SAMPLE_PERIOD_MS), TimerHandler, self);
+}
+
+void RadioStats::LogMessageSend(MessageSendInfo &info)
+{
+	if (info.messageType != OutgoingMessageType::kSecureSession || !info.payloadHeader->NeedsAck()) {
+		return;
+	}
+
+	uint16_t sessionId = info.packetHeader->GetSessionId();
+	uint32_t counter = info.packetHeader->GetMessageCounter();
+	PendingMessage *free = nullptr;
+	PendingMessage *oldest = nullptr;
+
+	/* The radio activity up to now belongs to the causes active before this message. */
+	Sample();
+
+	for (PendingMessage &message : mPending) {
+		if (!message.mInUse) {
+			free = free ? free : &message;
+			continue;
+		}
+
+		if (oldest == nullptr || static_cast<int32_t>(message.mSentMs - oldest->mSentMs) < 0) {
+			oldest = &message;
+		}
+	}
+
+	if (free == nullptr) {
+		free = oldest;
+		mPendingOverflows++;
+	}
+
+	const PayloadHeader &header = *info.payloadHeader;
+	bool report = header.IsInitiator() && header.HasProtocol(Protocols::InteractionModel::Id) &&
+		      header.HasMessageType(MsgType::ReportData);
+
+	*free = { true, report, false, sessionId, counter, k_uptime_get_32() };
+
+	if (report) {
+		mCauses[kReport].mEvents++;
+	}
+}
+
+void RadioStats::LogMessageReceived(MessageReceivedInfo &info)
+{
+	if (info.messageType != IncomingMessageType::kSecureUnicast || info.session == nullptr ||
+	    info.session->GetSessionType() != Transport::Session::SessionType::kSecure ||
+	    !info.payloadHeader->GetAckMessageCounter().HasValue()) {
+		return;
+	}
+
+	uint16_t peerSessionId = info.session->AsConstSecureSession()->GetPeerSessionId();
+	uint32_t ackCounter = info.payloadHeader->GetAckMessageCounter().Value();
+
+	for (PendingMessage &message : mPending) {
+		if (message.mInUse && message.mPeerSessionId == peerSessionId && message.mMessageCounter == ackCounter) {
+			/* The acknowledgement itself still belongs to the message. */
+			Sample();
+			message.mInUse = false;
+			return;
+		}
+	}
+}
+
+#if APP_MRP_ANALYTICS_AVAILABLE
+void RadioStats::OnTransmitEvent(const TransmitEvent &event)
+{
+	if (event.eventType != EventType::kRetransmission && event.eventType != EventType::kFailed) {
+		return;
+	}
+
+	PendingMessage *pending = nullptr;
+
+	/* The radio activity up to now belongs to the causes active before this event. */
+	Sample();
+
+	for (PendingMessage &message : mPending) {
+		if (message.mInUse && message.mMessageCounter == event.messageCounter) {
+			pending = &message;
+			break;
+		}
+	}
+
+	if (event.eventType == EventType::kFailed) {
+		/* MRP gave up, the message will not be acknowledged. */
+		if (pending) {
+			pending->mInUse = false;
+		}
+		return;
+	}
+
+	mCauses[kRetransmit].mEvents++;
+	/* Also attributes the next sample to the retransmission if the message is not tracked. */
+	mLatched |= BIT(kRetransmit);
+
+	if (pending) {
+		pending->mRetransmitted = true;
+	}
+}
+#endif /* APP_MRP_ANALYTICS_AVAILABLE */
+
+#ifdef CONFIG_SHELL
+void RadioStats::Print(const struct shell *shell)
+{
+	Availability availability = GetAvailability();
+
+	Sample();
+
+	shell_print(shell, "%-13s %-7s %-8s %-8s %-8s %-10s %-10s %-10s %-10s", "cause", "events", "tx", "rx",
+		    "retries", "tx_bytes", "rx_bytes", "on_ms", "on_us/event");
+
+	for (size_t i = 0; i < kCauseCount; i++) {
+		const CauseStats &cause = mCauses[i];
+
+		shell_print(shell, "%-13s %-7u %-8u %-8u %-8u %-10u %-10u %-10u %-10u", kCauseNames[i], cause.mEvents,
+			    cause.mRadio.mTxFrames, cause.mRadio.mRxFrames, cause.mRadio.mTxRetries, cause.mRadio.mTxBytes,
+			    cause.mRadio.mRxBytes, static_cast<uint32_t>(cause.mRadio.mRadioOnUs / 1000),
+			    cause.mEvents ? static_cast<uint32_t>(cause.mRadio.mRadioOnUs / cause.mEvents) : 0);
+	}
+
+	if (!availability.mRetries) {
+		shell_print(shell, "retries: not provided by this radio");
+	}
+
+	if (!availability.mRadioOn) {
+		shell_print(shell, "radio-on time: not provided by this radio, needs CONFIG_OPENTHREAD_RADIO_STATS");
+	}
+
+	if (!availability.mRetransmissions) {
+		shell_print(shell, "retransmit: not reported by this Matter library");
+	} else if (!APP_MRP_ANALYTICS_AVAILABLE) {
+		shell_print(shell, "retransmit: frames retried by the MAC, MRP retransmissions not reported");
+	}
+
+	shell_print(shell, "untracked messages: %u", mPendingOverflows);
+}
+
+static int RadioStatsShowHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::StackLock lock;
+
+	RadioStats::Instance().Print(shell);
+	return 0;
+}
+
+static int RadioStatsResetHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::StackLock lock;
+
+	RadioStats::Instance().Reset();
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_radio_stats,
+			       SHELL_CMD_ARG(show, NULL, "Print the radio activity per cause", RadioStatsShowHandler, 1,
+					     0),
+			       SHELL_CMD_ARG(reset, NULL, "Reset the radio statistics", RadioStatsResetHandler, 1, 0),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((app), radio, &sub_radio_stats, "Radio activity per cause", NULL, 1, 0);
+#endif /* CONFIG_SHELL */
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include "mrp_analytics.h"
+
+#include <system/SystemLayer.h>
+#include <tracing/backend.h>
+
+#include <stdint.h>
+
+struct shell;
+
+/*
+ * Radio activity split by its cause, used to find out how much radio time each report and each poll costs.
+ *
+ * The radio counters (frames, retries, IP bytes and, for 802.15.4, the radio-on time) are read at every boundary of
+ * a cause and every CONFIG_APP_RADIO_STATS_SAMPLE_PERIOD_MS, and the difference since the previous read is added to
+ * the cause of the highest priority that was active in between: commissioning, MRP retransmission, subscription
+ * report, SRP update, Thread data poll, other. Reports are observed through the Matter tracing backend interface and
+ * last until they are acknowledged. Retransmissions are reported by the reliable messaging layer and last until the
+ * message is acknowledged or given up. Without these reports, the frames retried by the Thread MAC are attributed to
+ * the retransmissions instead. The statistics are printed with the "app radio show" shell command and exposed in the
+ * Radio Diagnostics cluster on endpoint 0.
+ */
+class RadioStats : public chip::Tracing::Backend
+#if APP_MRP_ANALYTICS_AVAILABLE
+	, public chip::Messaging::ReliableMessageAnalyticsDelegate
+#endif
+{
+public:
+	enum Cause : uint8_t { kReport, kPoll, kRetransmit, kSrp, kCommissioning, kOther, kCauseCount };
+
+	struct Counters {
+		uint32_t mTxFrames;
+		uint32_t mRxFrames;
+		uint32_t mTxRetries;
+		uint32_t mTxBytes;
+		uint32_t mRxBytes;
+		uint64_t mRadioOnUs;
+	};
+
+	struct CauseStats {
+		uint32_t mEvents;
+		Counters mRadio;
+	};
+
+	/* Counters that the radio of this build does not provide. */
+	struct Availability {
+		bool mRetries;
+		bool mRadioOn;
+		bool mRetransmissions;
+	};
+
+	static RadioStats &Instance()
+	{
+		static RadioStats sRadioStats;
+		return sRadioStats;
+	}
+
+	CHIP_ERROR Init();
+	void Reset();
+	void Sample();
+	const CauseStats &Get(Cause cause) const { return mCauses[cause]; }
+	Counters GetTotals() const;
+	static Availability GetAvailability();
+	void Print(const struct shell *shell);
+
+	/* chip::Tracing::Backend */
+	void LogMessageSend(chip::Tracing::MessageSendInfo &info) override;
+	void LogMessageReceived(chip::Tracing::MessageReceivedInfo &info) override;
+
+#if APP_MRP_ANALYTICS_AVAILABLE
+	/* chip::Messaging::ReliableMessageAnalyticsDelegate */
+	void OnTransmitEvent(const TransmitEvent &event) override;
+#endif
+
+private:
+	struct Snapshot {
+		Counters mRadio;
+		uint32_t mPolls;
+	};
+
+	struct PendingMessage {
+		bool mInUse;
+		bool mReport;
+		bool mRetransmitted;
+		uint16_t mPeerSessionId;
+		uint32_t mMessageCounter;
+		uint32_t mSentMs;
+	};
+
+	static void TimerHandler(chip::System::Layer *layer, void *context);
+	static bool ReadSnapshot(Snapshot &snapshot);
+
+	uint8_t ActiveCauses();
+
+	CauseStats mCauses[kCauseCount];
+	PendingMessage mPending[CONFIG_APP_RADIO_STATS_MAX_PENDING];
+	Snapshot mLast{};
+	/* Causes active at any time since the last sample, as a bit mask. */
+	uint8_t mLatched{ 0 };
+	bool mSrpInProgress{ false };
+	bool mCommissioning{ false };
+	uint32_t mPendingOverflows{ 0 };
+};
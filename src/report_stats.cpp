@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "report_stats.h"
+
+#include <app/InteractionModelEngine.h>
+#include <app/server/Server.h>
+#include <platform/DiagnosticDataProvider.h>
+
+#ifdef CONFIG_APP_REPORT_STATS_MESSAGES
+#include <matter/tracing/build_config.h>
+#include <tracing/registry.h>
+#include <transport/SecureSession.h>
+#include <transport/TracingStructs.h>
+
+#if !MATTER_TRACING_ENABLED
+#error "CONFIG_APP_REPORT_STATS_MESSAGES requires the Matter library to be built with tracing support"
+#endif
+#endif
+
+#include <zephyr/logging/log.h>
+#include <zephyr/shell/shell.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+using namespace ::chip::app;
+
+namespace {
+
+k_tid_t sMatterThread;
+
+uint32_t MatterThreadCycles()
+{
+	k_thread_runtime_stats_t stats;
+
+	if (sMatterThread == nullptr || k_thread_runtime_stats_get(sMatterThread, &stats) != 0) {
+		return 0;
+	}
+
+	return static_cast<uint32_t>(stats.execution_cycles);
+}
+
+} /* namespace */
+
+CHIP_ERROR ReportStats::Init()
+{
+	InteractionModelEngine *engine = InteractionModelEngine::GetInstance();
+
+	Reset();
+
+	/* Keep any callback registered by the platform code (e.g. ICD) working. */
+	mNext = engine->GetAppCallback();
+	engine->RegisterReadHandlerAppCallback(this);
+
+#ifdef CONFIG_APP_REPORT_STATS_MESSAGES
+	Tracing::Register(*this);
+#endif
+
+	return CHIP_NO_ERROR;
+}
+
+void ReportStats::Reset()
+{
+	for (Subscription &sub : mSubscriptions) {
+		sub.mReports = 0;
+		sub.mLateReports = 0;
+		sub.mTotalBusyCycles = 0;
+		sub.mMaxBusyCycles = 0;
+	}
+
+	mEstablished = 0;
+	mTerminated = 0;
+	mDroppedReports = 0;
+	mUntracked = 0;
+	mPeakSubscriptions = 0;
+#ifdef CONFIG_APP_REPORT_STATS_MESSAGES
+	memset(mMessages, 0, sizeof(mMessages));
+#endif
+
+	DeviceLayer::GetDiagnosticDataProvider().ResetWatermarks();
+}
+
+ReportStats::Subscription *ReportStats::Find(ReadHandler &handler)
+{
+	for (Subscription &sub : mSubscriptions) {
+		if (sub.mInUse && sub.mId == handler.GetSubscriptionId() &&
+		    sub.mFabricIndex == handler.GetAccessingFabricIndex()) {
+			return &sub;
+		}
+	}
+
+	return nullptr;
+}
+
+ReportStats::Subscription *ReportStats::Allocate(ReadHandler &handler)
+{
+	for (Subscription &sub : mSubscriptions) {
+		if (!sub.mInUse) {
+			memset(&sub, 0, sizeof(sub));
+			sub.mInUse = true;
+			sub.mId = handler.GetSubscriptionId();
+			sub.mFabricIndex = handler.GetAccessingFabricIndex();
+			handler.GetReportingIntervals(sub.mMinInterval, sub.mMaxInterval);
+			sub.mLastReportMs = k_uptime_get();
+			return &sub;
+		}
+	}
+
+	mUntracked++;
+	return nullptr;
+}
+
+#ifdef CONFIG_APP_REPORT_STATS_MESSAGES
+ReportStats::FabricMessages *ReportStats::FindMessages(FabricIndex fabricIndex)
+{
+	FabricMessages *unused = nullptr;
+
+	for (FabricMessages &messages : mMessages) {
+		if (messages.mInUse && messages.mFabricIndex == fabricIndex) {
+			return &messages;
+		}
+
+		if (!messages.mInUse && unused == nullptr) {
+			unused = &messages;
+		}
+	}
+
+	if (unused != nullptr) {
+		*unused = { true, fabricIndex, 0, 0 };
+	}
+
+	return unused;
+}
+
+void ReportStats::LogMessageSend(Tracing::MessageSendInfo &info)
+{
+	if (info.messageType != Tracing::OutgoingMessageType::kSecureSession) {
+		return;
+	}
+
+	/* The packet header carries the session ID of the peer, the fabric is the one of the session using it. */
+	uint16_t peerSessionId = info.packetHeader->GetSessionId();
+	FabricIndex fabricIndex = kUndefinedFabricIndex;
+
+	Server::GetInstance().GetSecureSessionManager().GetSecureSessions().ForEachSession(
+		[peerSessionId, &fabricIndex](auto *session) {
+			if (session->GetPeerSessionId() != peerSessionId) {
+				return Loop::Continue;
+			}
+
+			fabricIndex = session->GetFabricIndex();
+			return Loop::Break;
+		});
+
+	FabricMessages *messages = FindMessages(fabricIndex);
+
+	if (messages != nullptr) {
+		messages->mSent++;
+	}
+}
+
+void ReportStats::LogMessageReceived(Tracing::MessageReceivedInfo &info)
+{
+	if (info.messageType != Tracing::IncomingMessageType::kSecureUnicast || info.session == nullptr) {
+		return;
+	}
+
+	FabricMessages *messages = FindMessages(info.session->GetFabricIndex());
+
+	if (messages != nullptr) {
+		messages->mReceived++;
+	}
+}
+#endif /* CONFIG_APP_REPORT_STATS_MESSAGES */
+
+CHIP_ERROR ReportStats::OnSubscriptionRequested(ReadHandler &handler, Transport::SecureSession &session)
+{
+	return mNext ? mNext->OnSubscriptionRequested(handler, session) : CHIP_NO_ERROR;
+}
+
+void ReportStats::OnSubscriptionEstablished(ReadHandler &handler)
+{
+	sMatterThread = k_current_get();
+	mEstablished++;
+
+	if (Allocate(handler) != nullptr) {
+		uint32_t active = InteractionModelEngine::GetInstance()->GetNumActiveReadHandlers(
+			ReadHandler::InteractionType::Subscribe);
+		mPeakSubscriptions = MAX(mPeakSubscriptions, active);
+	}
+
+	if (mNext) {
+		mNext->OnSubscriptionEstablished(handler);
+	}
+}
+
+void ReportStats::OnSubscriptionTerminated(ReadHandler &handler)
+{
+	Subscription *sub = Find(handler);
+
+	mTerminated++;
+
+	if (sub != nullptr) {
+		if (sub->mPending) {
+			mDroppedReports++;
+		}
+		sub->mInUse = false;
+	}
+
+	if (mNext) {
+		mNext->OnSubscriptionTerminated(handler);
+	}
+}
+
+void ReportStats::OnReportScheduled(ReadHandler &handler)
+{
+	Subscription *sub = Find(handler);
+
+	if (sub != nullptr && !sub->mPending) {
+		sub->mPending = true;
+		sub->mReportableCycles = MatterThreadCycles();
+	}
+}
+
+void ReportStats::OnReportSent(ReadHandler &handler)
+{
+	Subscription *sub = Find(handler);
+	int64_t now = k_uptime_get();
+
+	if (sub == nullptr) {
+		return;
+	}
+
+	if (sub->mPending) {
+		uint32_t cycles = MatterThreadCycles() - sub->mReportableCycles;
+
+		sub->mTotalBusyCycles += cycles;
+		sub->mMaxBusyCycles = MAX(sub->mMaxBusyCycles, cycles);
+		sub->mPending = false;
+	}
+
+	if (now - sub->mLastReportMs >
+	    static_cast<int64_t>(sub->mMaxInterval) * MSEC_PER_SEC + CONFIG_APP_REPORT_STATS_LATE_MARGIN_MS) {
+		sub->mLateReports++;
+	}
+
+	sub->mReports++;
+	sub->mLastReportMs = now;
+}
+
+void InstrumentedReportScheduler::OnBecameReportable(ReadHandler *handler)
+{
+	ReportSchedulerBase::OnBecameReportable(handler);
+	ReportStats::Instance().OnReportScheduled(*handler);
+}
+
+void InstrumentedReportScheduler::OnSubscriptionReportSent(ReadHandler *handler)
+{
+	ReportSchedulerBase::OnSubscriptionReportSent(handler);
+	ReportStats::Instance().OnReportSent(*handler);
+}
+
+#ifdef CONFIG_SHELL
+void ReportStats::Print(const struct shell *shell)
+{
+	uint64_t heapUsed = 0;
+	uint64_t heapPeak = 0;
+	uint32_t reports = 0;
+
+	DeviceLayer::GetDiagnosticDataProvider().GetCurrentHeapUsed(heapUsed);
+	DeviceLayer::GetDiagnosticDataProvider().GetCurrentHeapHighWatermark(heapPeak);
+
+	shell_print(shell, "%-4s %-3s %-9s %-8s %-5s %-12s %-12s", "fab", "id", "min/max", "reports", "late",
+		    "busy_avg_us", "busy_max_us");
+
+	for (const Subscription &sub : mSubscriptions) {
+		if (!sub.mInUse) {
+			continue;
+		}
+
+		uint32_t avgCycles = sub.mReports ? static_cast<uint32_t>(sub.mTotalBusyCycles / sub.mReports) : 0;
+
+		shell_print(shell, "%-4u %-3u %4u/%-4u %-8u %-5u %-12u %-12u", sub.mFabricIndex,
+			    static_cast<unsigned>(sub.mId), sub.mMinInterval, sub.mMaxInterval, sub.mReports,
+			    sub.mLateReports, k_cyc_to_us_floor32(avgCycles), k_cyc_to_us_floor32(sub.mMaxBusyCycles));
+		reports += sub.mReports;
+	}
+
+	shell_print(shell, "subscriptions: established %u, terminated %u, peak %u, untracked %u", mEstablished,
+		    mTerminated, mPeakSubscriptions, mUntracked);
+	shell_print(shell, "reports: sent %u, dropped %u", reports, mDroppedReports);
+
+#ifdef CONFIG_APP_REPORT_STATS_MESSAGES
+	for (const FabricMessages &messages : mMessages) {
+		if (!messages.mInUse) {
+			continue;
+		}
+
+		if (messages.mFabricIndex == kUndefinedFabricIndex) {
+			shell_print(shell, "messages: no fabric, sent %u, received %u", messages.mSent,
+				    messages.mReceived);
+		} else {
+			shell_print(shell, "messages: fabric %u, sent %u, received %u", messages.mFabricIndex,
+				    messages.mSent, messages.mReceived);
+		}
+	}
+#endif
+	shell_print(shell, "heap: used %u, peak %u", static_cast<unsigned>(heapUsed),
+		    static_cast<unsigned>(heapPeak));
+}
+
+static int ReportStatsShowHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::StackLock lock;
+
+	ReportStats::Instance().Print(shell);
+	return 0;
+}
+
+static int ReportStatsResetHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::StackLock lock;
+
+	ReportStats::Instance().Reset();
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_report_stats,
+			       SHELL_CMD_ARG(show, NULL, "Print subscription report statistics", ReportStatsShowHandler,
+					     1, 0),
+			       SHELL_CMD_ARG(reset, NULL, "Reset subscription report statistics",
+					     ReportStatsResetHandler, 1, 0),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((app), reports, &sub_report_stats, "Subscription report statistics", NULL, 1, 0);
+#endif /* CONFIG_SHELL */
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <app/ReadHandler.h>
+#include <app/reporting/ReportSchedulerImpl.h>
+#include <app/reporting/SynchronizedReportSchedulerImpl.h>
+#ifdef CONFIG_APP_REPORT_STATS_MESSAGES
+#include <tracing/backend.h>
+#endif
+
+#include <zephyr/kernel.h>
+
+struct shell;
+
+/*
+ * Per-subscription reporting statistics used to find out how the device behaves when many controllers subscribe
+ * to endpoint 1 at the same time. The statistics are collected by a thin wrapper around the default report
+ * scheduler and by a read handler application callback, so the Matter stack itself is left untouched. With
+ * CONFIG_APP_REPORT_STATS_MESSAGES the secure messages sent to and received from every fabric are also counted,
+ * observed through the Matter tracing backend interface.
+ */
+class ReportStats : public chip::app::ReadHandler::ApplicationCallback
+#ifdef CONFIG_APP_REPORT_STATS_MESSAGES
+	, public chip::Tracing::Backend
+#endif
+{
+public:
+	struct Subscription {
+		bool mInUse;
+		chip::SubscriptionId mId;
+		chip::FabricIndex mFabricIndex;
+		uint16_t mMinInterval;
+		uint16_t mMaxInterval;
+		bool mPending;
+		uint32_t mReports;
+		uint32_t mLateReports;
+		int64_t mLastReportMs;
+		/*
+		 * Matter thread execution cycles between the subscription becoming reportable and the report being
+		 * sent. This covers everything the Matter thread runs in the meantime, not only the report generation.
+		 */
+		uint32_t mReportableCycles;
+		uint64_t mTotalBusyCycles;
+		uint32_t mMaxBusyCycles;
+	};
+
+	/* Messages of the sessions of a fabric, or of no fabric (PASE) with kUndefinedFabricIndex. */
+	struct FabricMessages {
+		bool mInUse;
+		chip::FabricIndex mFabricIndex;
+		uint32_t mSent;
+		uint32_t mReceived;
+	};
+
+	static ReportStats &Instance()
+	{
+		static ReportStats sReportStats;
+		return sReportStats;
+	}
+
+	CHIP_ERROR Init();
+	void Reset();
+	void Print(const struct shell *shell);
+
+	/* Called by the report scheduler on the Matter thread. */
+	void OnReportScheduled(chip::app::ReadHandler &handler);
+	void OnReportSent(chip::app::ReadHandler &handler);
+
+	/* chip::app::ReadHandler::ApplicationCallback */
+	CHIP_ERROR OnSubscriptionRequested(chip::app::ReadHandler &handler,
+					   chip::Transport::SecureSession &session) override;
+	void OnSubscriptionEstablished(chip::app::ReadHandler &handler) override;
+	void OnSubscriptionTerminated(chip::app::ReadHandler &handler) override;
+
+#ifdef CONFIG_APP_REPORT_STATS_MESSAGES
+	/* chip::Tracing::Backend */
+	void LogMessageSend(chip::Tracing::MessageSendInfo &info) override;
+	void LogMessageReceived(chip::Tracing::MessageReceivedInfo &info) override;
+#endif
+
+private:
+	Subscription *Find(chip::app::ReadHandler &handler);
+	Subscription *Allocate(chip::app::ReadHandler &handler);
+#ifdef CONFIG_APP_REPORT_STATS_MESSAGES
+	FabricMessages *FindMessages(chip::FabricIndex fabricIndex);
+#endif
+
+	Subscription mSubscriptions[CONFIG_APP_REPORT_STATS_MAX_SUBSCRIPTIONS];
+#ifdef CONFIG_APP_REPORT_STATS_MESSAGES
+	FabricMessages mMessages[CHIP_CONFIG_MAX_FABRICS + 1];
+#endif
+	chip::app::ReadHandler::ApplicationCallback *mNext{ nullptr };
+	uint32_t mEstablished{ 0 };
+	uint32_t mTerminated{ 0 };
+	uint32_t mDroppedReports{ 0 };
+	uint32_t mUntracked{ 0 };
+	uint32_t mPeakSubscriptions{ 0 };
+};
+
+#if CHIP_CONFIG_SYNCHRONOUS_REPORTS_ENABLED
+using ReportSchedulerBase = chip::app::reporting::SynchronizedReportSchedulerImpl;
+#else
+using ReportSchedulerBase = chip::app::reporting::ReportSchedulerImpl;
+#endif
+
+/* Default report scheduler extended with hooks feeding ReportStats. */
+class InstrumentedReportScheduler : public ReportSchedulerBase {
+public:
+	explicit InstrumentedReportScheduler(TimerDelegate *timerDelegate) : ReportSchedulerBase(timerDelegate) {}
+
+	void OnBecameReportable(chip::app::ReadHandler *handler) override;
+	void OnSubscriptionReportSent(chip::app::ReadHandler *handler) override;
+};
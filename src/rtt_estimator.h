@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Smoothed round-trip time estimator following RFC 6298 (SRTT/RTTVAR with alpha = 1/8 and beta = 1/4). The state is
+ * kept in fixed point with 3 fractional bits for SRTT and 2 for RTTVAR, as in the classic TCP implementation, so
+ * the estimator does not need floating point and has no dependencies on the platform.
+ */
+class RttEstimator {
+public:
+	void Reset()
+	{
+		mScaledSrtt = 0;
+		mScaledRttvar = 0;
+		mSamples = 0;
+	}
+
+	void AddSample(uint32_t rttMs)
+	{
+		if (mSamples == 0) {
+			mScaledSrtt = rttMs << 3;
+			mScaledRttvar = rttMs << 1;
+		} else {
+			int32_t delta = static_cast<int32_t>(rttMs) - static_cast<int32_t>(mScaledSrtt >> 3);
+
+			mScaledSrtt = static_cast<uint32_t>(static_cast<int32_t>(mScaledSrtt) + delta);
+			if (delta < 0) {
+				delta = -delta;
+			}
+			mScaledRttvar = static_cast<uint32_t>(static_cast<int32_t>(mScaledRttvar) + delta -
+							      static_cast<int32_t>(mScaledRttvar >> 2));
+		}
+
+		if (mSamples < UINT32_MAX) {
+			mSamples++;
+		}
+	}
+
+	bool HasSamples() const { return mSamples > 0; }
+	uint32_t Samples() const { return mSamples; }
+	uint32_t SrttMs() const { return mScaledSrtt >> 3; }
+	uint32_t RttvarMs() const { return mScaledRttvar >> 2; }
+
+	/* Retransmission timeout, SRTT + 4 * RTTVAR, clamped to the given bounds. */
+	uint32_t RtoMs(uint32_t minMs, uint32_t maxMs) const
+	{
+		uint32_t rto = SrttMs() + (RttvarMs() << 2);
+
+		if (rto < minMs) {
+			return minMs;
+		}
+
+		return rto > maxMs ? maxMs : rto;
+	}
+
+private:
+	uint32_t mScaledSrtt{ 0 };
+	uint32_t mScaledRttvar{ 0 };
+	uint32_t mSamples{ 0 };
+};
+
+/*
+ * Outstanding messages whose acknowledgement yields a round-trip time sample. Only messages acknowledged without a
+ * retransmission are sampled (Karn's algorithm). A retransmission reuses the message, so it must be reported with
+ * MarkRetransmitted() by whoever performs it rather than detected from the messages sent. When the table is full,
+ * the oldest message is replaced, as messages that are never acknowledged would otherwise block it.
+ */
+template <size_t N> class RttSampler {
+public:
+	/* Returns false if an older message had to be dropped to make room. */
+	bool Track(uint16_t sessionId, uint32_t counter, uint32_t nowMs)
+	{
+		Pending *slot = nullptr;
+
+		for (Pending &message : mPending) {
+			if (!message.mInUse) {
+				slot = &message;
+				break;
+			}
+
+			if (slot == nullptr || message.mSentMs < slot->mSentMs) {
+				slot = &message;
+			}
+		}
+
+		bool dropped = slot->mInUse;
+
+		*slot = { true, false, sessionId, counter, nowMs };
+
+		return !dropped;
+	}
+
+	/* Returns true if the message is tracked. */
+	bool MarkRetransmitted(uint32_t counter)
+	{
+		Pending *message = Find(counter);
+
+		if (message != nullptr) {
+			message->mRetransmitted = true;
+		}
+
+		return message != nullptr;
+	}
+
+	/* Stops tracking a message that will not be acknowledged. */
+	void Release(uint32_t counter)
+	{
+		Pending *message = Find(counter);
+
+		if (message != nullptr) {
+			message->mInUse = false;
+		}
+	}
+
+	/* Returns true and the round-trip time if the acknowledged message yields a sample. */
+	bool Acknowledge(uint16_t sessionId, uint32_t counter, uint32_t nowMs, uint32_t &rttMs)
+	{
+		for (Pending &message : mPending) {
+			if (!message.mInUse || message.mSessionId != sessionId || message.mCounter != counter) {
+				continue;
+			}
+
+			message.mInUse = false;
+
+			if (message.mRetransmitted) {
+				return false;
+			}
+
+			rttMs = nowMs - message.mSentMs;
+			return true;
+		}
+
+		return false;
+	}
+
+private:
+	struct Pending {
+		bool mInUse;
+		bool mRetransmitted;
+		uint16_t mSessionId;
+		uint32_t mCounter;
+		uint32_t mSentMs;
+	};
+
+	Pending *Find(uint32_t counter)
+	{
+		for (Pending &message : mPending) {
+			if (message.mInUse && message.mCounter == counter) {
+				return &message;
+			}
+		}
+
+		return nullptr;
+	}
+
+	Pending mPending[N]{};
+};
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "sensor_config.h"
+#include "sensor_config_cluster.h"
+
+#include <platform/CHIPDeviceLayer.h>
+
+#include <zephyr/logging/log.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/toolchain.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+namespace {
+
+constexpr char kConfigKey[] = "app/sensor/config";
+constexpr uint8_t kRecordVersion = 1;
+constexpr const char *kFilterNames[MeasurementFilter::kTypeCount] = { "none", "moving_average", "exponential" };
+
+/* Stored layout of the configuration, independent of the padding of SensorConfig::Config. */
+struct __packed Record {
+	uint8_t mVersion;
+	uint32_t mSamplePeriodMs;
+	uint16_t mTemperatureDeadband;
+	uint16_t mHumidityDeadband;
+	uint8_t mFilterType;
+	uint8_t mHistoryDecimation;
+};
+
+int LoadRecordCallback(const char *key, size_t length, settings_read_cb readCb, void *cbArg, void *param)
+{
+	if (length != sizeof(Record)) {
+		return -EINVAL;
+	}
+
+	return readCb(cbArg, param, length) == sizeof(Record) ? 0 : -EIO;
+}
+
+} /* namespace */
+
+bool SensorConfig::IsValid(const Config &config)
+{
+	return config.mSamplePeriodMs >= kMinSamplePeriodMs && config.mSamplePeriodMs <= kMaxSamplePeriodMs &&
+	       config.mTemperatureDeadband <= kMaxDeadband && config.mHumidityDeadband <= kMaxDeadband &&
+	       config.mFilterType < MeasurementFilter::kTypeCount && config.mHistoryDecimation > 0;
+}
+
+void SensorConfig::Init(k_tid_t sensorThread)
+{
+	Record record{};
+
+	mSensorThread = sensorThread;
+	k_work_init_delayable(&mSaveWork, SaveHandler);
+
+	/* Does nothing if the Matter stack initialized the settings already. */
+	if (settings_subsys_init() != 0 || settings_load_subtree_direct(kConfigKey, LoadRecordCallback, &record) != 0 ||
+	    record.mVersion != kRecordVersion) {
+		return;
+	}
+
+	Config config = { record.mSamplePeriodMs, record.mTemperatureDeadband, record.mHumidityDeadband,
+			  static_cast<MeasurementFilter::Type>(record.mFilterType), record.mHistoryDecimation };
+
+	if (!IsValid(config)) {
+		LOG_WRN("Ignoring invalid stored sensor configuration");
+		return;
+	}
+
+	mConfig = config;
+}
+
+SensorConfig::Config SensorConfig::Get()
+{
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+	Config config = mConfig;
+
+	k_spin_unlock(&mLock, key);
+
+	return config;
+}
+
+CHIP_ERROR SensorConfig::Set(const Config &config)
+{
+	VerifyOrReturnError(IsValid(config), CHIP_ERROR_INVALID_ARGUMENT);
+
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+	bool periodChanged = config.mSamplePeriodMs != mConfig.mSamplePeriodMs;
+
+	mConfig = config;
+
+	k_spin_unlock(&mLock, key);
+
+	/* A shorter period would otherwise only apply after the current one. */
+	if (periodChanged && mSensorThread) {
+		k_wakeup(mSensorThread);
+	}
+
+	k_work_reschedule(&mSaveWork, K_MSEC(kSaveDelayMs));
+
+	return CHIP_NO_ERROR;
+}
+
+void SensorConfig::SaveHandler(struct k_work *work)
+{
+	SensorConfig &self = Instance();
+	Config config = self.Get();
+	Record record = { kRecordVersion,	       config.mSamplePeriodMs, config.mTemperatureDeadband,
+			  config.mHumidityDeadband, config.mFilterType,	   config.mHistoryDecimation };
+	int err = settings_save_one(kConfigKey, &record, sizeof(record));
+
+	if (err) {
+		self.mSaveErrors++;
+		LOG_WRN("Failed to store sensor configuration: %d", err);
+		return;
+	}
+
+	self.mSaves++;
+}
+
+#ifdef CONFIG_SHELL
+void SensorConfig::Print(const struct shell *shell)
+{
+	Config config = Get();
+
+	shell_print(shell, "sample period: %u ms", config.mSamplePeriodMs);
+	shell_print(shell, "deadband: temperature %u, humidity %u (0.01 units)", config.mTemperatureDeadband,
+		    config.mHumidityDeadband);
+	shell_print(shell, "filter: %s", kFilterNames[config.mFilterType]);
+	shell_print(shell, "history decimation: 1/%u", config.mHistoryDecimation);
+	shell_print(shell, "saves: %u, errors %u", mSaves, mSaveErrors);
+}
+
+static int SensorConfigShowHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	SensorConfig::Instance().Print(shell);
+	return 0;
+}
+
+static int SensorConfigDefaultsHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::StackLock lock;
+
+	SensorConfig::Instance().Set(SensorConfig::kDefaults);
+	SensorConfiguration::ReportConfigChanged();
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_sensor_config,
+			       SHELL_CMD_ARG(show, NULL, "Print the sensor sampling and reporting configuration",
+					     SensorConfigShowHandler, 1, 0),
+			       SHELL_CMD_ARG(defaults, NULL, "Restore and store the default configuration",
+					     SensorConfigDefaultsHandler, 1, 0),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((app), sensor_config, &sub_sensor_config, "Sensor configuration", NULL, 1, 0);
+#endif /* CONFIG_SHELL */
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include "sensor_filter.h"
+
+#include <lib/core/CHIPError.h>
+
+#include <zephyr/kernel.h>
+
+#include <stdint.h>
+
+struct shell;
+
+/*
+ * Sampling and reporting configuration of the sensor pipeline, written through the Sensor Configuration cluster on
+ * endpoint 1 and applied to the running sensor thread at its next sample. The whole configuration is stored as a
+ * single settings record, written once the writes have settled for kSaveDelayMs, so a controller writing all the
+ * attributes in a row costs one flash write.
+ */
+class SensorConfig {
+public:
+	struct Config {
+		uint32_t mSamplePeriodMs;
+		/* Minimum change of a MeasuredValue attribute, in its units: 0.01 °C and 0.01 %. */
+		uint16_t mTemperatureDeadband;
+		uint16_t mHumidityDeadband;
+		MeasurementFilter::Type mFilterType;
+		/* One sample out of this number is appended to the history log. */
+		uint8_t mHistoryDecimation;
+	};
+
+	static constexpr Config kDefaults = { 10000, 0, 0, MeasurementFilter::kNone, 1 };
+	static constexpr uint32_t kMinSamplePeriodMs = 1000;
+	static constexpr uint32_t kMaxSamplePeriodMs = 3600000;
+	static constexpr uint16_t kMaxDeadband = 1000;
+	static constexpr uint32_t kSaveDelayMs = 1000;
+
+	static SensorConfig &Instance()
+	{
+		static SensorConfig sSensorConfig;
+		return sSensorConfig;
+	}
+
+	static bool IsValid(const Config &config);
+
+	/* Loads the stored configuration, must be called after the settings subsystem is initialized. */
+	void Init(k_tid_t sensorThread);
+	Config Get();
+	/* Thread-safe, returns CHIP_ERROR_INVALID_ARGUMENT if a value is out of its range. */
+	CHIP_ERROR Set(const Config &config);
+	void Print(const struct shell *shell);
+
+private:
+	static void SaveHandler(struct k_work *work);
+
+	struct k_spinlock mLock;
+	struct k_work_delayable mSaveWork;
+	k_tid_t mSensorThread{ nullptr };
+	Config mConfig = kDefaults;
+	uint32_t mSaves{ 0 };
+	uint32_t mSaveErrors{ 0 };
+};
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "sensor_config_cluster.h"
+#include "sensor_config.h"
+
+#include <app/AttributeAccessInterface.h>
+#include <app/AttributeAccessInterfaceRegistry.h>
+#include <app/reporting/reporting.h>
+
+using namespace ::chip;
+using namespace ::chip::app;
+
+namespace SensorConfiguration {
+namespace {
+
+constexpr EndpointId kSensorEndpointId = 1;
+
+class SensorConfigAttrAccess : public AttributeAccessInterface {
+public:
+	SensorConfigAttrAccess() : AttributeAccessInterface(MakeOptional(kSensorEndpointId), kClusterId) {}
+
+	CHIP_ERROR Read(const ConcreteReadAttributePath &path, AttributeValueEncoder &encoder) override
+	{
+		SensorConfig::Config config = SensorConfig::Instance().Get();
+
+		switch (path.mAttributeId) {
+		case Attributes::kSamplePeriod:
+			return encoder.Encode(config.mSamplePeriodMs);
+		case Attributes::kTemperatureDeadband:
+			return encoder.Encode(config.mTemperatureDeadband);
+		case Attributes::kHumidityDeadband:
+			return encoder.Encode(config.mHumidityDeadband);
+		case Attributes::kFilterType:
+			return encoder.Encode(static_cast<uint8_t>(config.mFilterType));
+		case Attributes::kHistoryDecimation:
+			return encoder.Encode(config.mHistoryDecimation);
+		default:
+			/* Global attributes are served from the attribute storage. */
+			return CHIP_NO_ERROR;
+		}
+	}
+
+	CHIP_ERROR Write(const ConcreteDataAttributePath &path, AttributeValueDecoder &decoder) override
+	{
+		SensorConfig::Config config = SensorConfig::Instance().Get();
+		uint8_t filterType = config.mFilterType;
+
+		switch (path.mAttributeId) {
+		case Attributes::kSamplePeriod:
+			ReturnErrorOnFailure(decoder.Decode(config.mSamplePeriodMs));
+			break;
+		case Attributes::kTemperatureDeadband:
+			ReturnErrorOnFailure(decoder.Decode(config.mTemperatureDeadband));
+			break;
+		case Attributes::kHumidityDeadband:
+			ReturnErrorOnFailure(decoder.Decode(config.mHumidityDeadband));
+			break;
+		case Attributes::kFilterType:
+			ReturnErrorOnFailure(decoder.Decode(filterType));
+			config.mFilterType = static_cast<MeasurementFilter::Type>(filterType);
+			break;
+		case Attributes::kHistoryDecimation:
+			ReturnErrorOnFailure(decoder.Decode(config.mHistoryDecimation));
+			break;
+		default:
+			return CHIP_IM_GLOBAL_STATUS(UnsupportedWrite);
+		}
+
+		if (SensorConfig::Instance().Set(config) != CHIP_NO_ERROR) {
+			return CHIP_IM_GLOBAL_STATUS(ConstraintError);
+		}
+
+		return CHIP_NO_ERROR;
+	}
+};
+
+SensorConfigAttrAccess sAttrAccess;
+
+} /* namespace */
+
+void ReportConfigChanged()
+{
+	for (AttributeId id = Attributes::kSamplePeriod; id <= Attributes::kHistoryDecimation; id++) {
+		MatterReportingAttributeChangeCallback(kSensorEndpointId, kClusterId, id);
+	}
+}
+
+} /* namespace SensorConfiguration */
+
+void MatterSensorConfigurationPluginServerInitCallback()
+{
+	AttributeAccessInterfaceRegistry::Instance().Register(&SensorConfiguration::sAttrAccess);
+}
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <lib/core/DataModelTypes.h>
+
+/*
+ * Manufacturer specific Sensor Configuration cluster on endpoint 1, defined in
+ * src/default_zap/sensor-configuration-cluster.xml. The attributes are read from and written to SensorConfig, a
+ * write of a value out of its range fails with CONSTRAINT_ERROR.
+ */
+namespace SensorConfiguration {
+
+inline constexpr chip::ClusterId kClusterId = 0xFFF1FC43;
+
+namespace Attributes {
+inline constexpr chip::AttributeId kSamplePeriod = 0x0000;
+inline constexpr chip::AttributeId kTemperatureDeadband = 0x0001;
+inline constexpr chip::AttributeId kHumidityDeadband = 0x0002;
+inline constexpr chip::AttributeId kFilterType = 0x0003;
+inline constexpr chip::AttributeId kHistoryDecimation = 0x0004;
+} /* namespace Attributes */
+
+/* Notifies the subscribers of a change made outside of the cluster. Must be called on the Matter thread. */
+void ReportConfigChanged();
+
+} /* namespace SensorConfiguration */
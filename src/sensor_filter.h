@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Smoothing of one measured quantity before it is published: a moving average of the last kWindow samples, or an
+ * exponential average with alpha = 1 / kWindow, which reacts as fast but needs no history. The filter restarts from
+ * the next sample when its type changes.
+ */
+class MeasurementFilter {
+public:
+	enum Type : uint8_t { kNone, kMovingAverage, kExponential, kTypeCount };
+
+	static constexpr size_t kWindow = 4;
+
+	float Apply(Type type, float value)
+	{
+		if (type != mType) {
+			mType = type;
+			mCount = 0;
+		}
+
+		switch (type) {
+		case kMovingAverage: {
+			float sum = 0.0f;
+
+			mWindow[mCount % kWindow] = value;
+			mCount++;
+
+			size_t count = mCount < kWindow ? mCount : kWindow;
+
+			for (size_t i = 0; i < count; i++) {
+				sum += mWindow[i];
+			}
+
+			return sum / count;
+		}
+		case kExponential:
+			mAverage = mCount == 0 ? value : mAverage + (value - mAverage) / kWindow;
+			mCount = 1;
+			return mAverage;
+		default:
+			return value;
+		}
+	}
+
+private:
+	Type mType{ kNone };
+	size_t mCount{ 0 };
+	float mWindow[kWindow]{};
+	float mAverage{ 0.0f };
+};
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "server_init_params.h"
+
+#ifdef CONFIG_APP_REPORT_STATS
+#include "report_stats.h"
+
+#include <app/DefaultTimerDelegate.h>
+#endif
+#ifdef CONFIG_APP_SETTINGS_COALESCE
+#include "settings_coalesce.h"
+#endif
+#ifdef CONFIG_APP_CASE_RESUMPTION
+#include "session_resumption.h"
+#endif
+#ifdef CONFIG_APP_IM_STATS
+#include "im_stats.h"
+#endif
+
+using namespace ::chip;
+
+CHIP_ERROR AppServerInitParams::InitializeStaticResourcesBeforeServerInit()
+{
+	ReturnErrorOnFailure(CommonCaseDeviceServerInitParams::InitializeStaticResourcesBeforeServerInit());
+
+#ifdef CONFIG_APP_REPORT_STATS
+	static app::DefaultTimerDelegate sTimerDelegate;
+	static InstrumentedReportScheduler sReportScheduler(&sTimerDelegate);
+
+	reportScheduler = &sReportScheduler;
+#endif
+
+#ifdef CONFIG_APP_SETTINGS_COALESCE
+	CoalescingStorageDelegate &storage = CoalescingStorageDelegate::Instance();
+
+	storage.Init(persistentStorageDelegate);
+	persistentStorageDelegate = &storage;
+#endif
+
+#ifdef CONFIG_APP_CASE_RESUMPTION
+	SessionResumptionCache &cache = SessionResumptionCache::Instance();
+
+#ifdef CONFIG_APP_CASE_RESUMPTION_PERSIST
+	cache.Init(sessionResumptionStorage);
+#else
+	cache.Init(nullptr);
+#endif
+	sessionResumptionStorage = &cache;
+#endif
+
+#ifdef CONFIG_APP_IM_STATS
+	/* Set last, the provider persists attributes through the final storage delegate. */
+	static ImStatsDataModelProvider sDataModelProvider;
+
+	sDataModelProvider.SetPersistentStorageDelegate(persistentStorageDelegate);
+	dataModelProvider = &sDataModelProvider;
+#endif
+
+	return CHIP_NO_ERROR;
+}
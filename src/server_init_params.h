@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <app/server/Server.h>
+
+/*
+ * Server initialization parameters replacing the default report scheduler, session resumption storage and data model
+ * provider and wrapping the persistent storage delegate, depending on the enabled application features. The replacements are injected after the base class has
+ * set up its static resources, as the base class always installs its own.
+ */
+class AppServerInitParams : public chip::CommonCaseDeviceServerInitParams {
+public:
+	CHIP_ERROR InitializeStaticResourcesBeforeServerInit() override;
+};
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "session_resumption.h"
+
+#include <platform/CHIPDeviceLayer.h>
+
+#ifdef CONFIG_APP_CASE_RESUMPTION_TIMING
+#include <matter/tracing/build_config.h>
+#include <tracing/registry.h>
+#endif
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/crc.h>
+
+#include <string.h>
+
+#if defined(CONFIG_APP_CASE_RESUMPTION_TIMING) && !MATTER_TRACING_ENABLED
+#error "CONFIG_APP_CASE_RESUMPTION_TIMING requires the Matter library to be built with tracing support"
+#endif
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+
+namespace {
+
+constexpr uint32_t kCacheMagic = 0x53524331;
+
+struct Cache {
+	uint32_t mMagic;
+	uint32_t mUseCounter;
+	SessionResumptionCache::Entry mEntries[CONFIG_APP_CASE_RESUMPTION_ENTRIES];
+	uint32_t mCrc;
+};
+
+#ifdef CONFIG_APP_CASE_RESUMPTION_RETAINED
+__noinit
+#endif
+Cache sCache;
+
+uint32_t CacheCrc()
+{
+	return crc32_ieee(reinterpret_cast<const uint8_t *>(&sCache), offsetof(Cache, mCrc));
+}
+
+uint32_t ElapsedUs(uint32_t startCycles)
+{
+	return k_cyc_to_us_floor32(k_cycle_get_32() - startCycles);
+}
+
+} /* namespace */
+
+void SessionResumptionCache::Init(SessionResumptionStorage *backing)
+{
+	mBacking = backing;
+
+	/* Entries kept over a reset are only trusted if the whole cache is intact. */
+	if (sCache.mMagic != kCacheMagic || sCache.mCrc != CacheCrc()) {
+		Crypto::ClearSecretData(reinterpret_cast<uint8_t *>(&sCache), sizeof(sCache));
+		sCache.mMagic = kCacheMagic;
+		Commit();
+	}
+}
+
+CHIP_ERROR SessionResumptionCache::Start()
+{
+#ifdef CONFIG_APP_CASE_RESUMPTION_TIMING
+	Tracing::Register(*this);
+#endif
+
+	return CHIP_NO_ERROR;
+}
+
+void SessionResumptionCache::Commit()
+{
+	sCache.mCrc = CacheCrc();
+}
+
+SessionResumptionCache::Entry *SessionResumptionCache::Find(const ScopedNodeId &node)
+{
+	for (Entry &entry : sCache.mEntries) {
+		if (entry.mInUse && entry.mNodeId == node.GetNodeId() && entry.mFabricIndex == node.GetFabricIndex()) {
+			return &entry;
+		}
+	}
+
+	return nullptr;
+}
+
+SessionResumptionCache::Entry *SessionResumptionCache::Find(ConstResumptionIdView resumptionId)
+{
+	for (Entry &entry : sCache.mEntries) {
+		if (entry.mInUse && memcmp(entry.mResumptionId, resumptionId.data(), kResumptionIdSize) == 0) {
+			return &entry;
+		}
+	}
+
+	return nullptr;
+}
+
+void SessionResumptionCache::Touch(Entry &entry)
+{
+	entry.mLastUsed = ++sCache.mUseCounter;
+	Commit();
+}
+
+void SessionResumptionCache::Load(Entry &entry, Crypto::P256ECDHDerivedSecret &sharedSecret, CATValues &peerCATs)
+{
+	memcpy(sharedSecret.Bytes(), entry.mSecret, entry.mSecretLength);
+	sharedSecret.SetLength(entry.mSecretLength);
+	static_assert(sizeof(entry.mPeerCATs) == sizeof(peerCATs.values), "CAT storage mismatch");
+	memcpy(peerCATs.values.data(), entry.mPeerCATs, sizeof(entry.mPeerCATs));
+	Touch(entry);
+}
+
+void SessionResumptionCache::Remove(Entry &entry)
+{
+	Crypto::ClearSecretData(reinterpret_cast<uint8_t *>(&entry), sizeof(entry));
+}
+
+void SessionResumptionCache::Store(const ScopedNodeId &node, ConstResumptionIdView resumptionId,
+				   const Crypto::P256ECDHDerivedSecret &sharedSecret, const CATValues &peerCATs)
+{
+	Entry *entry = Find(node);
+
+	if (entry == nullptr) {
+		for (Entry &candidate : sCache.mEntries) {
+			if (!candidate.mInUse) {
+				entry = &candidate;
+				break;
+			}
+
+			if (entry == nullptr || candidate.mLastUsed < entry->mLastUsed) {
+				entry = &candidate;
+			}
+		}
+
+		if (entry->mInUse) {
+			mStats.mEvictions++;
+		}
+	}
+
+	Remove(*entry);
+	entry->mInUse = true;
+	entry->mFabricIndex = node.GetFabricIndex();
+	entry->mNodeId = node.GetNodeId();
+	memcpy(entry->mResumptionId, resumptionId.data(), kResumptionIdSize);
+	entry->mSecretLength = static_cast<uint8_t>(MIN(sharedSecret.Length(), sizeof(entry->mSecret)));
+	memcpy(entry->mSecret, sharedSecret.ConstBytes(), entry->mSecretLength);
+	memcpy(entry->mPeerCATs, peerCATs.values.data(), sizeof(entry->mPeerCATs));
+	Touch(*entry);
+}
+
+CHIP_ERROR SessionResumptionCache::FindByScopedNodeId(const ScopedNodeId &node, ResumptionIdStorage &resumptionId,
+						      Crypto::P256ECDHDerivedSecret &sharedSecret,
+						      CATValues &peerCATs)
+{
+	Entry *entry = Find(node);
+
+	if (entry != nullptr) {
+		memcpy(resumptionId.data(), entry->mResumptionId, kResumptionIdSize);
+		Load(*entry, sharedSecret, peerCATs);
+		return CHIP_NO_ERROR;
+	}
+
+	VerifyOrReturnError(mBacking != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+	ReturnErrorOnFailure(mBacking->FindByScopedNodeId(node, resumptionId, sharedSecret, peerCATs));
+	Store(node, ConstResumptionIdView(resumptionId), sharedSecret, peerCATs);
+
+	return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SessionResumptionCache::FindByResumptionId(ConstResumptionIdView resumptionId, ScopedNodeId &node,
+						      Crypto::P256ECDHDerivedSecret &sharedSecret,
+						      CATValues &peerCATs)
+{
+	Entry *entry = Find(resumptionId);
+
+	mStats.mResumeAttempts++;
+
+	if (entry != nullptr) {
+		node = ScopedNodeId(entry->mNodeId, entry->mFabricIndex);
+		Load(*entry, sharedSecret, peerCATs);
+		mStats.mResumeHits++;
+		mHandshakeResumed = true;
+		return CHIP_NO_ERROR;
+	}
+
+	VerifyOrReturnError(mBacking != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+	ReturnErrorOnFailure(mBacking->FindByResumptionId(resumptionId, node, sharedSecret, peerCATs));
+	Store(node, resumptionId, sharedSecret, peerCATs);
+	mStats.mResumeHits++;
+	mStats.mBackingHits++;
+	mHandshakeResumed = true;
+
+	return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SessionResumptionCache::Save(const ScopedNodeId &node, ConstResumptionIdView resumptionId,
+					const Crypto::P256ECDHDerivedSecret &sharedSecret, const CATValues &peerCATs)
+{
+	/* A session has been established, which ends the handshake started by the last Sigma1. */
+	if (mHandshakeInProgress) {
+		uint32_t durationUs = ElapsedUs(mHandshakeStart);
+
+		if (mHandshakeResumed) {
+			mStats.mResumedHandshakes++;
+			mStats.mResumedUs += durationUs;
+			mStats.mMaxResumedUs = MAX(mStats.mMaxResumedUs, durationUs);
+		} else {
+			mStats.mFullHandshakes++;
+			mStats.mFullUs += durationUs;
+			mStats.mMaxFullUs = MAX(mStats.mMaxFullUs, durationUs);
+		}
+
+		mHandshakeInProgress = false;
+	}
+
+	Store(node, resumptionId, sharedSecret, peerCATs);
+
+	return mBacking ? mBacking->Save(node, resumptionId, sharedSecret, peerCATs) : CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SessionResumptionCache::Delete(const ScopedNodeId &node)
+{
+	Entry *entry = Find(node);
+
+	if (entry != nullptr) {
+		Remove(*entry);
+	}
+
+	Commit();
+
+	return mBacking ? mBacking->Delete(node) : CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SessionResumptionCache::DeleteAll(FabricIndex fabricIndex)
+{
+	for (Entry &entry : sCache.mEntries) {
+		if (entry.mInUse && entry.mFabricIndex == fabricIndex) {
+			Remove(entry);
+		}
+	}
+
+	Commit();
+
+	return mBacking ? mBacking->DeleteAll(fabricIndex) : CHIP_NO_ERROR;
+}
+
+void SessionResumptionCache::AbortHandshake()
+{
+	if (mHandshakeInProgress) {
+		mStats.mFailedHandshakes++;
+		mHandshakeInProgress = false;
+	}
+}
+
+void SessionResumptionCache::TraceBegin(const char *label, const char *group)
+{
+	if (strcmp(group, "CASESession") != 0) {
+		return;
+	}
+
+	if (strcmp(label, "HandleSigma1_and_SendSigma2") == 0) {
+		/* The CASE server handles one handshake at a time, so a new Sigma1 supersedes an unfinished one. */
+		AbortHandshake();
+		mHandshakeStart = k_cycle_get_32();
+		mHandshakeInProgress = true;
+		mHandshakeResumed = false;
+	} else if (strcmp(label, "AbortPendingEstablish") == 0) {
+		/* Failed or timed out, the next session established does not end this handshake. */
+		AbortHandshake();
+	}
+}
+
+#ifdef CONFIG_SHELL
+void SessionResumptionCache::Print(const struct shell *shell)
+{
+	uint32_t entries = 0;
+
+	for (const Entry &entry : sCache.mEntries) {
+		if (entry.mInUse) {
+			shell_print(shell, "fabric %u, node 0x" ChipLogFormatX64 ", last used %u", entry.mFabricIndex,
+				    ChipLogValueX64(entry.mNodeId), entry.mLastUsed);
+			entries++;
+		}
+	}
+
+	shell_print(shell, "entries: %u/%u, evictions: %u", entries, CONFIG_APP_CASE_RESUMPTION_ENTRIES,
+		    mStats.mEvictions);
+	shell_print(shell, "resumption: %u attempts, %u succeeded (%u from settings)", mStats.mResumeAttempts,
+		    mStats.mResumeHits, mStats.mBackingHits);
+#ifdef CONFIG_APP_CASE_RESUMPTION_TIMING
+	shell_print(shell, "resumed handshakes: %u, avg %u ms, max %u ms", mStats.mResumedHandshakes,
+		    mStats.mResumedHandshakes ? static_cast<uint32_t>(mStats.mResumedUs / mStats.mResumedHandshakes /
+								       USEC_PER_MSEC) :
+						0,
+		    mStats.mMaxResumedUs / USEC_PER_MSEC);
+	shell_print(shell, "full handshakes: %u, avg %u ms, max %u ms", mStats.mFullHandshakes,
+		    mStats.mFullHandshakes ?
+			    static_cast<uint32_t>(mStats.mFullUs / mStats.mFullHandshakes / USEC_PER_MSEC) :
+			    0,
+		    mStats.mMaxFullUs / USEC_PER_MSEC);
+	shell_print(shell, "failed handshakes: %u", mStats.mFailedHandshakes);
+#endif
+}
+
+static int CaseShowHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::StackLock lock;
+
+	SessionResumptionCache::Instance().Print(shell);
+	return 0;
+}
+
+static int CaseResetHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::StackLock lock;
+
+	SessionResumptionCache::Instance().ResetStats();
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_resumption,
+			       SHELL_CMD_ARG(show, NULL, "Print CASE session resumption statistics", CaseShowHandler, 1,
+					     0),
+			       SHELL_CMD_ARG(reset, NULL, "Reset CASE session resumption statistics", CaseResetHandler,
+					     1, 0),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((app), resumption, &sub_resumption, "CASE session resumption", NULL, 1, 0);
+#endif /* CONFIG_SHELL */
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CASEAuthTag.h>
+#include <protocols/secure_channel/SessionResumptionStorage.h>
+#include <tracing/backend.h>
+
+#include <stdint.h>
+#include <string.h>
+
+struct shell;
+
+/*
+ * CASE session resumption storage keeping the resumption state of the last CONFIG_APP_CASE_RESUMPTION_ENTRIES
+ * peers in RAM, evicting the least recently used one. With CONFIG_APP_CASE_RESUMPTION_RETAINED the entries live in
+ * RAM that is not cleared on boot, so they survive a warm reset, and with CONFIG_APP_CASE_RESUMPTION_PERSIST they are
+ * also written through to the default storage in the settings, so they survive a power loss at the cost of flash
+ * writes on every session establishment.
+ *
+ * The resumption attempts are counted by the storage. With CONFIG_APP_CASE_RESUMPTION_TIMING the handshake times are
+ * measured from the start of the Sigma1 handling, observed through the Matter tracing backend interface, to the
+ * establishment of the session. A handshake aborted or superseded by the next Sigma1 is counted as failed instead.
+ */
+class SessionResumptionCache : public chip::SessionResumptionStorage, public chip::Tracing::Backend {
+public:
+	struct Stats {
+		uint32_t mResumeAttempts;
+		uint32_t mResumeHits;
+		uint32_t mBackingHits;
+		uint32_t mEvictions;
+		uint32_t mResumedHandshakes;
+		uint32_t mFullHandshakes;
+		uint32_t mFailedHandshakes;
+		uint64_t mResumedUs;
+		uint64_t mFullUs;
+		uint32_t mMaxResumedUs;
+		uint32_t mMaxFullUs;
+	};
+
+	static SessionResumptionCache &Instance()
+	{
+		static SessionResumptionCache sSessionResumptionCache;
+		return sSessionResumptionCache;
+	}
+
+	/* Called before the server starts. The backing storage may be null. */
+	void Init(chip::SessionResumptionStorage *backing);
+	/* Starts measuring the handshakes. */
+	CHIP_ERROR Start();
+	void Print(const struct shell *shell);
+	void ResetStats() { memset(&mStats, 0, sizeof(mStats)); }
+
+	/* chip::SessionResumptionStorage */
+	CHIP_ERROR FindByScopedNodeId(const chip::ScopedNodeId &node, ResumptionIdStorage &resumptionId,
+				      chip::Crypto::P256ECDHDerivedSecret &sharedSecret,
+				      chip::CATValues &peerCATs) override;
+	CHIP_ERROR FindByResumptionId(ConstResumptionIdView resumptionId, chip::ScopedNodeId &node,
+				      chip::Crypto::P256ECDHDerivedSecret &sharedSecret,
+				      chip::CATValues &peerCATs) override;
+	CHIP_ERROR Save(const chip::ScopedNodeId &node, ConstResumptionIdView resumptionId,
+			const chip::Crypto::P256ECDHDerivedSecret &sharedSecret,
+			const chip::CATValues &peerCATs) override;
+	CHIP_ERROR Delete(const chip::ScopedNodeId &node) override;
+	CHIP_ERROR DeleteAll(chip::FabricIndex fabricIndex) override;
+
+	/* chip::Tracing::Backend */
+	void TraceBegin(const char *label, const char *group) override;
+
+	/* Plain data, so it can be kept in RAM not initialized on boot. */
+	struct Entry {
+		bool mInUse;
+		chip::FabricIndex mFabricIndex;
+		uint8_t mSecretLength;
+		uint32_t mLastUsed;
+		chip::NodeId mNodeId;
+		uint8_t mResumptionId[kResumptionIdSize];
+		uint8_t mSecret[chip::Crypto::kMax_ECDH_Secret_Length];
+		chip::CASEAuthTag mPeerCATs[chip::kMaxSubjectCATAttributeCount];
+	};
+
+private:
+	Entry *Find(const chip::ScopedNodeId &node);
+	Entry *Find(ConstResumptionIdView resumptionId);
+	void Store(const chip::ScopedNodeId &node, ConstResumptionIdView resumptionId,
+		   const chip::Crypto::P256ECDHDerivedSecret &sharedSecret, const chip::CATValues &peerCATs);
+	void Load(Entry &entry, chip::Crypto::P256ECDHDerivedSecret &sharedSecret, chip::CATValues &peerCATs);
+	void Remove(Entry &entry);
+	void Touch(Entry &entry);
+	void Commit();
+	void AbortHandshake();
+
+	chip::SessionResumptionStorage *mBacking{ nullptr };
+	uint32_t mHandshakeStart{ 0 };
+	bool mHandshakeInProgress{ false };
+	bool mHandshakeResumed{ false };
+	Stats mStats{};
+};
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "settings_coalesce.h"
+
+#include <platform/CHIPDeviceLayer.h>
+
+#include <zephyr/logging/log.h>
+#include <zephyr/shell/shell.h>
+
+#include <string.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+
+CoalescingStorageDelegate::Entry *CoalescingStorageDelegate::Find(const char *key)
+{
+	for (Entry &entry : mEntries) {
+		if (entry.mInUse && strcmp(entry.mKey, key) == 0) {
+			return &entry;
+		}
+	}
+
+	return nullptr;
+}
+
+CoalescingStorageDelegate::Entry *CoalescingStorageDelegate::Allocate(const char *key)
+{
+	for (int attempt = 0; attempt < 2; attempt++) {
+		for (Entry &entry : mEntries) {
+			if (!entry.mInUse) {
+				entry.mInUse = true;
+				strncpy(entry.mKey, key, sizeof(entry.mKey) - 1);
+				entry.mKey[sizeof(entry.mKey) - 1] = '\0';
+				return &entry;
+			}
+		}
+
+		/* All entries are pending, make room by writing them out now. */
+		Flush();
+	}
+
+	return nullptr;
+}
+
+size_t CoalescingStorageDelegate::PendingCount() const
+{
+	size_t count = 0;
+
+	for (const Entry &entry : mEntries) {
+		count += entry.mInUse;
+	}
+
+	return count;
+}
+
+CHIP_ERROR CoalescingStorageDelegate::SyncGetKeyValue(const char *key, void *buffer, uint16_t &size)
+{
+	Entry *entry = Find(key);
+
+	if (entry == nullptr) {
+		return mStorage->SyncGetKeyValue(key, buffer, size);
+	}
+
+	if (size < entry->mSize) {
+		memcpy(buffer, entry->mValue, size);
+		return CHIP_ERROR_BUFFER_TOO_SMALL;
+	}
+
+	memcpy(buffer, entry->mValue, entry->mSize);
+	size = entry->mSize;
+
+	return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CoalescingStorageDelegate::SyncSetKeyValue(const char *key, const void *value, uint16_t size)
+{
+	Entry *entry;
+
+	if (strncmp(key, CONFIG_APP_SETTINGS_COALESCE_PREFIX, sizeof(CONFIG_APP_SETTINGS_COALESCE_PREFIX) - 1) != 0 ||
+	    size > sizeof(entry->mValue) || strlen(key) > kKeyLengthMax) {
+		return mStorage->SyncSetKeyValue(key, value, size);
+	}
+
+	entry = Find(key);
+	if (entry != nullptr) {
+		mCoalescedWrites++;
+	} else {
+		entry = Allocate(key);
+		VerifyOrReturnError(entry != nullptr, mStorage->SyncSetKeyValue(key, value, size));
+	}
+
+	memcpy(entry->mValue, value, size);
+	entry->mSize = size;
+
+	if (!DeviceLayer::SystemLayer().IsTimerActive(FlushTimerHandler, this)) {
+		return DeviceLayer::SystemLayer().StartTimer(
+			System::Clock::Milliseconds32(CONFIG_APP_SETTINGS_COALESCE_DELAY_MS), FlushTimerHandler, this);
+	}
+
+	return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CoalescingStorageDelegate::SyncDeleteKeyValue(const char *key)
+{
+	Entry *entry = Find(key);
+	CHIP_ERROR err = mStorage->SyncDeleteKeyValue(key);
+
+	if (entry != nullptr) {
+		entry->mInUse = false;
+
+		/* The key may have never reached the storage. */
+		if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND) {
+			err = CHIP_NO_ERROR;
+		}
+	}
+
+	return err;
+}
+
+void CoalescingStorageDelegate::Flush()
+{
+	DeviceLayer::SystemLayer().CancelTimer(FlushTimerHandler, this);
+
+	for (Entry &entry : mEntries) {
+		if (!entry.mInUse) {
+			continue;
+		}
+
+		CHIP_ERROR err = mStorage->SyncSetKeyValue(entry.mKey, entry.mValue, entry.mSize);
+
+		if (err != CHIP_NO_ERROR) {
+			LOG_ERR("Failed to write %s: %" CHIP_ERROR_FORMAT, entry.mKey, err.Format());
+		}
+
+		entry.mInUse = false;
+	}
+}
+
+void CoalescingStorageDelegate::InstallShutdownHook()
+{
+	mNextDelegate = DeviceLayer::PlatformMgr().GetDelegate();
+	DeviceLayer::PlatformMgr().SetDelegate(this);
+}
+
+void CoalescingStorageDelegate::OnStartUp(uint32_t softwareVersion)
+{
+	if (mNextDelegate != nullptr) {
+		mNextDelegate->OnStartUp(softwareVersion);
+	}
+}
+
+void CoalescingStorageDelegate::OnShutDown()
+{
+	if (PendingCount() > 0) {
+		LOG_INF("Writing %u coalesced values before shutdown", static_cast<unsigned>(PendingCount()));
+		Flush();
+	}
+
+	if (mNextDelegate != nullptr) {
+		mNextDelegate->OnShutDown();
+	}
+}
+
+void CoalescingStorageDelegate::FlushTimerHandler(System::Layer *layer, void *context)
+{
+	static_cast<CoalescingStorageDelegate *>(context)->Flush();
+}
+
+#ifdef CONFIG_SHELL
+void CoalescingStorageDelegate::Print(const struct shell *shell)
+{
+	shell_print(shell, "coalesced writes: %u", mCoalescedWrites);
+	shell_print(shell, "pending writes: %u", static_cast<unsigned>(PendingCount()));
+}
+
+static int SettingsCoalesceShowHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::StackLock lock;
+
+	CoalescingStorageDelegate::Instance().Print(shell);
+	return 0;
+}
+
+static int SettingsCoalesceFlushHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::StackLock lock;
+
+	CoalescingStorageDelegate::Instance().Flush();
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_settings_coalesce,
+			       SHELL_CMD_ARG(show, NULL, "Print coalesced write counters", SettingsCoalesceShowHandler,
+					     1, 0),
+			       SHELL_CMD_ARG(flush, NULL, "Write pending coalesced values",
+					     SettingsCoalesceFlushHandler, 1, 0),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((app), coalesce, &sub_settings_coalesce, "Coalesced Matter storage writes", NULL, 1, 0);
+#endif /* CONFIG_SHELL */
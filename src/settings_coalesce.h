@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <platform/PlatformManager.h>
+#include <system/SystemLayer.h>
+
+struct shell;
+
+/*
+ * Persistent storage delegate delaying writes of keys starting with CONFIG_APP_SETTINGS_COALESCE_PREFIX (persisted
+ * attribute values by default) by CONFIG_APP_SETTINGS_COALESCE_DELAY_MS. A rewrite of a pending key only replaces
+ * the value held in RAM, so a burst of changes results in a single flash write. Reads return the pending value.
+ * Other keys, such as fabric data and counters, are written through immediately.
+ *
+ * The pending values are also written when the Matter server shuts down, which precedes the reboot after an OTA
+ * update is applied and the factory reset. To observe it, the module installs itself as the platform manager
+ * delegate and forwards the events to the delegate it replaces.
+ */
+class CoalescingStorageDelegate : public chip::PersistentStorageDelegate,
+				  public chip::DeviceLayer::PlatformManagerDelegate {
+public:
+	static CoalescingStorageDelegate &Instance()
+	{
+		static CoalescingStorageDelegate sCoalescingStorageDelegate;
+		return sCoalescingStorageDelegate;
+	}
+
+	void Init(chip::PersistentStorageDelegate *storage) { mStorage = storage; }
+	/* Must be called after the server initialization, which installs the Basic Information cluster delegate. */
+	void InstallShutdownHook();
+	/* Writes all pending values to the underlying storage. */
+	void Flush();
+	size_t PendingCount() const;
+	void Print(const struct shell *shell);
+
+	CHIP_ERROR SyncGetKeyValue(const char *key, void *buffer, uint16_t &size) override;
+	CHIP_ERROR SyncSetKeyValue(const char *key, const void *value, uint16_t size) override;
+	CHIP_ERROR SyncDeleteKeyValue(const char *key) override;
+
+	/* chip::DeviceLayer::PlatformManagerDelegate */
+	void OnStartUp(uint32_t softwareVersion) override;
+	void OnShutDown() override;
+
+private:
+	struct Entry {
+		bool mInUse;
+		char mKey[chip::PersistentStorageDelegate::kKeyLengthMax + 1];
+		uint8_t mValue[CONFIG_APP_SETTINGS_COALESCE_MAX_VALUE_SIZE];
+		uint16_t mSize;
+	};
+
+	static void FlushTimerHandler(chip::System::Layer *layer, void *context);
+
+	Entry *Find(const char *key);
+	Entry *Allocate(const char *key);
+
+	chip::PersistentStorageDelegate *mStorage{ nullptr };
+	chip::DeviceLayer::PlatformManagerDelegate *mNextDelegate{ nullptr };
+	uint32_t mCoalescedWrites{ 0 };
+	Entry mEntries[CONFIG_APP_SETTINGS_COALESCE_ENTRIES];
+};
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "settings_stats.h"
+
+#include <platform/CHIPDeviceLayer.h>
+
+#if defined(CONFIG_SETTINGS_NVS)
+#include <zephyr/fs/nvs.h>
+#elif defined(CONFIG_SETTINGS_ZMS)
+#include <zephyr/fs/zms.h>
+#endif
+#include <zephyr/logging/log.h>
+#include <zephyr/shell/shell.h>
+
+#include <string.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+/* The settings subsystem has no public accessor for the store used for saving. */
+extern "C" struct settings_store *settings_save_dst;
+
+using namespace ::chip;
+
+CHIP_ERROR SettingsStats::Init()
+{
+	int err = settings_subsys_init();
+
+	if (err) {
+		return System::MapErrorZephyr(err);
+	}
+
+	VerifyOrReturnError(settings_save_dst != nullptr, CHIP_ERROR_INCORRECT_STATE);
+	VerifyOrReturnError(mStore == nullptr, CHIP_NO_ERROR);
+
+	k_mutex_init(&mLock);
+	Reset();
+
+	mStore = settings_save_dst;
+	mWrapperItf = *mStore->cs_itf;
+	mWrapperItf.csi_load = Load;
+	mWrapperItf.csi_save_start = SaveStart;
+	mWrapperItf.csi_save = Save;
+	mWrapperItf.csi_save_end = SaveEnd;
+	mWrapperItf.csi_storage_get = StorageGet;
+	mWrapper.cs_itf = &mWrapperItf;
+	settings_dst_register(&mWrapper);
+
+	return CHIP_NO_ERROR;
+}
+
+void SettingsStats::Reset()
+{
+	k_mutex_lock(&mLock, K_FOREVER);
+
+	memset(mKeys, 0, sizeof(mKeys));
+	memset(&mOther, 0, sizeof(mOther));
+	strncpy(mOther.mName, "<other>", sizeof(mOther.mName) - 1);
+	mGcPauses = 0;
+	mGcPauseMaxUs = 0;
+	mGcPauseTotalUs = 0;
+	mLastGcPauseMs = 0;
+
+	k_mutex_unlock(&mLock);
+}
+
+int SettingsStats::Save(struct settings_store *cs, const char *name, const char *value, size_t length)
+{
+	SettingsStats &self = Instance();
+	uint32_t start = k_cycle_get_32();
+	int err = self.mStore->cs_itf->csi_save(self.mStore, name, value, length);
+
+	self.Record(name, value != nullptr ? length : 0, k_cyc_to_us_floor32(k_cycle_get_32() - start));
+
+	return err;
+}
+
+int SettingsStats::SaveStart(struct settings_store *cs)
+{
+	struct settings_store *store = Instance().mStore;
+
+	return store->cs_itf->csi_save_start ? store->cs_itf->csi_save_start(store) : 0;
+}
+
+int SettingsStats::SaveEnd(struct settings_store *cs)
+{
+	struct settings_store *store = Instance().mStore;
+
+	return store->cs_itf->csi_save_end ? store->cs_itf->csi_save_end(store) : 0;
+}
+
+void *SettingsStats::StorageGet(struct settings_store *cs)
+{
+	struct settings_store *store = Instance().mStore;
+
+	return store->cs_itf->csi_storage_get ? store->cs_itf->csi_storage_get(store) : nullptr;
+}
+
+int SettingsStats::Load(struct settings_store *cs, const struct settings_load_arg *arg)
+{
+	struct settings_store *store = Instance().mStore;
+
+	return store->cs_itf->csi_load(store, arg);
+}
+
+SettingsStats::Key *SettingsStats::Find(const char *name)
+{
+	for (Key &key : mKeys) {
+		if (key.mName[0] == '\0') {
+			strncpy(key.mName, name, sizeof(key.mName) - 1);
+			return &key;
+		}
+
+		if (strncmp(key.mName, name, sizeof(key.mName) - 1) == 0) {
+			return &key;
+		}
+	}
+
+	return &mOther;
+}
+
+void SettingsStats::Record(const char *name, size_t length, uint32_t durationUs)
+{
+	k_mutex_lock(&mLock, K_FOREVER);
+
+	Key *key = Find(name);
+
+	/* A zero length write is how the settings backends delete a key. */
+	if (length == 0) {
+		key->mDeletes++;
+	} else {
+		key->mWrites++;
+		key->mBytes += length;
+	}
+	key->mMaxUs = MAX(key->mMaxUs, durationUs);
+
+	if (durationUs >= CONFIG_APP_SETTINGS_GC_PAUSE_THRESHOLD_MS * USEC_PER_MSEC) {
+		mGcPauses++;
+		mGcPauseMaxUs = MAX(mGcPauseMaxUs, durationUs);
+		mGcPauseTotalUs += durationUs;
+		mLastGcPauseMs = k_uptime_get();
+		LOG_DBG("Settings write of %s stalled for %u us", name, durationUs);
+	}
+
+	k_mutex_unlock(&mLock);
+}
+
+#ifdef CONFIG_SHELL
+namespace {
+
+ssize_t FreeSpace()
+{
+	void *storage = nullptr;
+
+	if (settings_storage_get(&storage) != 0 || storage == nullptr) {
+		return -ENOTSUP;
+	}
+
+#if defined(CONFIG_SETTINGS_NVS)
+	return nvs_calc_free_space(static_cast<struct nvs_fs *>(storage));
+#elif defined(CONFIG_SETTINGS_ZMS)
+	return zms_calc_free_space(static_cast<struct zms_fs *>(storage));
+#else
+	return -ENOTSUP;
+#endif
+}
+
+} /* namespace */
+
+void SettingsStats::Print(const struct shell *shell)
+{
+	uint32_t writes = 0;
+	uint64_t bytes = 0;
+	uint64_t flashBytes = 0;
+	ssize_t freeSpace = FreeSpace();
+
+	k_mutex_lock(&mLock, K_FOREVER);
+
+	shell_print(shell, "%-24s %-7s %-7s %-9s %-8s", "key", "writes", "deletes", "bytes", "max_us");
+
+	auto printKey = [&](const Key &key) {
+		if (key.mWrites == 0 && key.mDeletes == 0) {
+			return;
+		}
+
+		shell_print(shell, "%-24s %-7u %-7u %-9u %-8u", key.mName, key.mWrites, key.mDeletes, key.mBytes,
+			    key.mMaxUs);
+		writes += key.mWrites + key.mDeletes;
+		bytes += key.mBytes;
+		flashBytes += key.mBytes + (key.mWrites + key.mDeletes) * kEntryOverhead;
+	};
+
+	for (const Key &key : mKeys) {
+		printKey(key);
+	}
+	printKey(mOther);
+
+	shell_print(shell, "total: %u writes, %u B of data, ~%u B of flash (x%u.%02u)", writes,
+		    static_cast<unsigned>(bytes), static_cast<unsigned>(flashBytes),
+		    static_cast<unsigned>(bytes ? flashBytes / bytes : 0),
+		    static_cast<unsigned>(bytes ? (flashBytes * 100 / bytes) % 100 : 0));
+	shell_print(shell, "gc pauses: %u, max %u us, total %u ms, last %lld ms ago", mGcPauses, mGcPauseMaxUs,
+		    static_cast<unsigned>(mGcPauseTotalUs / USEC_PER_MSEC),
+		    mLastGcPauseMs ? k_uptime_get() - mLastGcPauseMs : -1LL);
+
+	k_mutex_unlock(&mLock);
+
+	if (freeSpace >= 0) {
+		shell_print(shell, "free space: %d B", static_cast<int>(freeSpace));
+	}
+}
+
+static int SettingsStatsShowHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::StackLock lock;
+
+	SettingsStats::Instance().Print(shell);
+	return 0;
+}
+
+static int SettingsStatsResetHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	SettingsStats::Instance().Reset();
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_settings_stats,
+			       SHELL_CMD_ARG(show, NULL, "Print settings write statistics", SettingsStatsShowHandler, 1,
+					     0),
+			       SHELL_CMD_ARG(reset, NULL, "Reset settings write statistics", SettingsStatsResetHandler,
+					     1, 0),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((app), settings, &sub_settings_stats, "Settings write statistics", NULL, 1, 0);
+#endif /* CONFIG_SHELL */
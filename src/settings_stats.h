@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+
+struct shell;
+
+/*
+ * Settings write accounting. The settings store used for saving is wrapped, so that every write and delete issued
+ * by any module (Matter, OpenThread, the application) is counted per key together with the number of bytes written.
+ * Writes taking longer than CONFIG_APP_SETTINGS_GC_PAUSE_THRESHOLD_MS are counted as garbage collection pauses, as
+ * that is what makes an NVS or ZMS write stall. The statistics are printed with the "app settings" shell command.
+ */
+class SettingsStats {
+public:
+	/* Estimated flash overhead of a single settings entry (allocation table entry). */
+	static constexpr size_t kEntryOverhead = 8;
+
+	struct Key {
+		char mName[24];
+		uint32_t mWrites;
+		uint32_t mDeletes;
+		uint32_t mBytes;
+		uint32_t mMaxUs;
+	};
+
+	static SettingsStats &Instance()
+	{
+		static SettingsStats sSettingsStats;
+		return sSettingsStats;
+	}
+
+	CHIP_ERROR Init();
+	void Reset();
+	void Print(const struct shell *shell);
+
+private:
+	static int Save(struct settings_store *cs, const char *name, const char *value, size_t length);
+	static int SaveStart(struct settings_store *cs);
+	static int SaveEnd(struct settings_store *cs);
+	static void *StorageGet(struct settings_store *cs);
+	static int Load(struct settings_store *cs, const struct settings_load_arg *arg);
+
+	void Record(const char *name, size_t length, uint32_t durationUs);
+	Key *Find(const char *name);
+
+	struct settings_store *mStore{ nullptr };
+	struct settings_store mWrapper;
+	struct settings_store_itf mWrapperItf;
+	struct k_mutex mLock;
+
+	Key mKeys[CONFIG_APP_SETTINGS_STATS_MAX_KEYS];
+	Key mOther;
+	uint32_t mGcPauses{ 0 };
+	uint32_t mGcPauseMaxUs{ 0 };
+	uint64_t mGcPauseTotalUs{ 0 };
+	int64_t mLastGcPauseMs{ 0 };
+};
@@ -0,0 +1,15 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/shell/shell.h>
+
+/*
+ * Root of the application shell commands. Modules add their own subcommands with
+ * SHELL_SUBCMD_ADD((app), ...), so that only the features enabled in the build show up.
+ */
+SHELL_SUBCMD_SET_CREATE(app_cmds, (app));
+
+SHELL_CMD_REGISTER(app, &app_cmds, "Application commands", NULL);
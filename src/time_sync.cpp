@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "time_sync.h"
+
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app/clusters/bindings/BindingManager.h>
+#include <app/server/Server.h>
+#include <app/util/binding-table.h>
+#include <controller/ReadInteraction.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <zephyr/logging/log.h>
+#include <zephyr/shell/shell.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+using namespace ::chip::app;
+using namespace ::chip::app::Clusters;
+
+namespace {
+
+/* Gives the network time to come up after boot. */
+constexpr uint32_t kFirstSyncDelayS = 30;
+
+int64_t UptimeUs()
+{
+	return k_ticks_to_us_floor64(k_uptime_ticks());
+}
+
+} /* namespace */
+
+CHIP_ERROR TimeSync::Init()
+{
+#ifndef CONFIG_APP_MEASUREMENT_PUBLISH
+	/* The binding table is loaded by the binding manager, which the measurement publisher initializes otherwise. */
+	ReturnErrorOnFailure(BindingManager::GetInstance().Init({ &Server::GetInstance().GetFabricTable(),
+								  Server::GetInstance().GetCASESessionManager(),
+								  &Server::GetInstance().GetPersistentStorage() }));
+#endif
+
+	Schedule(kFirstSyncDelayS);
+
+	return CHIP_NO_ERROR;
+}
+
+uint32_t TimeSync::Timestamp()
+{
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+	int64_t uptimeUs = UptimeUs();
+	uint64_t timeUs = mClock.IsSynced() ? mClock.Now(uptimeUs) : static_cast<uint64_t>(uptimeUs);
+
+	k_spin_unlock(&mLock, key);
+
+	return static_cast<uint32_t>(timeUs / USEC_PER_SEC);
+}
+
+void TimeSync::Schedule(uint32_t delayS)
+{
+	DeviceLayer::SystemLayer().StartTimer(System::Clock::Seconds32(delayS), TimerHandler, this);
+}
+
+void TimeSync::TimerHandler(System::Layer *layer, void *context)
+{
+	static_cast<TimeSync *>(context)->Sync();
+}
+
+void TimeSync::Sync()
+{
+	DeviceLayer::SystemLayer().CancelTimer(TimerHandler, this);
+
+	if (mPending) {
+		return;
+	}
+
+	for (const EmberBindingTableEntry &entry : BindingTable::GetInstance()) {
+		if (entry.type != MATTER_UNICAST_BINDING || !entry.clusterId.has_value() ||
+		    entry.clusterId.value() != TimeSynchronization::Id) {
+			continue;
+		}
+
+		mPending = true;
+		mSourceEndpoint = entry.remote;
+		Server::GetInstance().GetCASESessionManager()->FindOrEstablishSession(
+			ScopedNodeId(entry.nodeId, entry.fabricIndex), &mOnConnected, &mOnConnectionFailure);
+		return;
+	}
+
+	/* No time source is bound yet, look again later. */
+	Schedule(CONFIG_APP_TIME_SYNC_MIN_INTERVAL_S);
+}
+
+void TimeSync::HandleDeviceConnected(void *context, Messaging::ExchangeManager &exchangeMgr,
+				     const SessionHandle &sessionHandle)
+{
+	TimeSync &sync = *static_cast<TimeSync *>(context);
+	CHIP_ERROR err;
+
+	sync.mRequestUptimeUs = UptimeUs();
+	err = Controller::ReadAttribute<TimeSynchronization::Attributes::UTCTime::TypeInfo>(
+		&exchangeMgr, sessionHandle, sync.mSourceEndpoint,
+		[](const ConcreteDataAttributePath &, const DataModel::Nullable<uint64_t> &utcTime) {
+			if (utcTime.IsNull()) {
+				Instance().OnFailure(CHIP_ERROR_INCORRECT_STATE);
+			} else {
+				Instance().OnTime(utcTime.Value());
+			}
+		},
+		[](const ConcreteDataAttributePath *, CHIP_ERROR error) { Instance().OnFailure(error); });
+
+	if (err != CHIP_NO_ERROR) {
+		sync.OnFailure(err);
+	}
+}
+
+void TimeSync::HandleDeviceConnectionFailure(void *context, const ScopedNodeId &peerId, CHIP_ERROR error)
+{
+	static_cast<TimeSync *>(context)->OnFailure(error);
+}
+
+void TimeSync::OnTime(uint64_t utcUs)
+{
+	/* The time source read the time about halfway through the round trip. */
+	int64_t uptimeUs = (mRequestUptimeUs + UptimeUs()) / 2;
+	k_spinlock_key_t key = k_spin_lock(&mLock);
+	bool first = !mClock.IsSynced();
+	int64_t errorUs = mClock.Sync(uptimeUs, utcUs);
+
+	k_spin_unlock(&mLock, key);
+
+	mPending = false;
+	mSyncs++;
+	mIntervalS = first ? CONFIG_APP_TIME_SYNC_MIN_INTERVAL_S :
+			     DriftClock::NextIntervalS(mIntervalS, errorUs, CONFIG_APP_TIME_SYNC_MAX_ERROR_MS,
+						       CONFIG_APP_TIME_SYNC_MIN_INTERVAL_S,
+						       CONFIG_APP_TIME_SYNC_MAX_INTERVAL_S);
+
+	LOG_INF("Time synchronized, error %lld us, drift %d ppb, next in %u s", errorUs, mClock.DriftPpb(),
+		mIntervalS);
+	Schedule(mIntervalS);
+}
+
+void TimeSync::OnFailure(CHIP_ERROR error)
+{
+	LOG_WRN("Time synchronization failed: %" CHIP_ERROR_FORMAT, error.Format());
+
+	mPending = false;
+	mFailures++;
+	Schedule(CONFIG_APP_TIME_SYNC_RETRY_INTERVAL_S);
+}
+
+#ifdef CONFIG_SHELL
+void TimeSync::Print(const struct shell *shell)
+{
+	if (!mClock.IsSynced()) {
+		shell_print(shell, "not synchronized, uptime %u s", Timestamp());
+	} else {
+		shell_print(shell, "time: %u s since 2000-01-01, last sync %lld s ago", Timestamp(),
+			    (UptimeUs() - mClock.LastSyncUptimeUs()) / USEC_PER_SEC);
+		shell_print(shell, "last error: %lld us, drift: %d ppb, interval: %u s", mClock.LastErrorUs(),
+			    mClock.DriftPpb(), mIntervalS);
+	}
+	shell_print(shell, "syncs: %u, failures: %u", mSyncs, mFailures);
+}
+
+static int TimeShowHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::StackLock lock;
+
+	TimeSync::Instance().Print(shell);
+	return 0;
+}
+
+static int TimeSyncHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::StackLock lock;
+
+	TimeSync::Instance().Sync();
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_time,
+			       SHELL_CMD_ARG(show, NULL, "Print the time synchronization state", TimeShowHandler, 1, 0),
+			       SHELL_CMD_ARG(sync, NULL, "Synchronize the time now", TimeSyncHandler, 1, 0),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((app), time, &sub_time, "Time synchronization", NULL, 1, 0);
+#endif /* CONFIG_SHELL */
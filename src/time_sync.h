@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include "time_sync_clock.h"
+
+#include <app/OperationalSessionSetup.h>
+#include <lib/core/CHIPError.h>
+#include <system/SystemLayer.h>
+
+#include <zephyr/kernel.h>
+
+struct shell;
+
+/*
+ * Keeps the UTC time by reading the UTCTime attribute of the Time Synchronization cluster from a trusted time source.
+ * The time source is the node of the first unicast entry of the Binding cluster on endpoint 1 bound to the Time
+ * Synchronization cluster. The synchronization interval grows from CONFIG_APP_TIME_SYNC_MIN_INTERVAL_S up to
+ * CONFIG_APP_TIME_SYNC_MAX_INTERVAL_S as long as the drift-compensated clock stays within
+ * CONFIG_APP_TIME_SYNC_MAX_ERROR_MS of the time source.
+ */
+class TimeSync {
+public:
+	static TimeSync &Instance()
+	{
+		static TimeSync sTimeSync;
+		return sTimeSync;
+	}
+
+	CHIP_ERROR Init();
+	/*
+	 * Returns the seconds since the Matter epoch, or the seconds since boot if the time has not been synchronized
+	 * yet. Thread-safe.
+	 */
+	uint32_t Timestamp();
+	/* Synchronizes right away. */
+	void Sync();
+	void Print(const struct shell *shell);
+
+private:
+	static void TimerHandler(chip::System::Layer *layer, void *context);
+	static void HandleDeviceConnected(void *context, chip::Messaging::ExchangeManager &exchangeMgr,
+					  const chip::SessionHandle &sessionHandle);
+	static void HandleDeviceConnectionFailure(void *context, const chip::ScopedNodeId &peerId, CHIP_ERROR error);
+
+	void OnTime(uint64_t utcUs);
+	void OnFailure(CHIP_ERROR error);
+	void Schedule(uint32_t delayS);
+
+	DriftClock mClock;
+	struct k_spinlock mLock;
+	chip::EndpointId mSourceEndpoint{ 0 };
+	int64_t mRequestUptimeUs{ 0 };
+	bool mPending{ false };
+	uint32_t mIntervalS{ CONFIG_APP_TIME_SYNC_MIN_INTERVAL_S };
+	uint32_t mSyncs{ 0 };
+	uint32_t mFailures{ 0 };
+
+	chip::Callback::Callback<chip::OnDeviceConnected> mOnConnected{ HandleDeviceConnected, this };
+	chip::Callback::Callback<chip::OnDeviceConnectionFailure> mOnConnectionFailure{ HandleDeviceConnectionFailure,
+											 this };
+};
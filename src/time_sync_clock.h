@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * UTC clock derived from the uptime and the time of the last synchronization. The relative drift of the local clock
+ * is estimated from the error observed at each synchronization and compensated between them, so the clock stays
+ * accurate over long synchronization intervals. Times are in microseconds, UTC in the Matter epoch (2000-01-01).
+ */
+class DriftClock {
+public:
+	static constexpr int32_t kMaxDriftPpb = 500000;
+	/* Synchronizations closer than this are too noisy to tell anything about the drift. */
+	static constexpr int64_t kMinDriftIntervalUs = 600LL * 1000 * 1000;
+	/*
+	 * An error above both limits cannot come from the drift, which is at most kMaxDriftPpb and is estimated from
+	 * half of the error, so the time of the source was stepped and the estimate starts over.
+	 */
+	static constexpr int64_t kMinStepUs = 1000LL * 1000;
+	static constexpr int64_t kMaxErrorPpb = 2LL * kMaxDriftPpb;
+
+	bool IsSynced() const { return mSynced; }
+	int32_t DriftPpb() const { return mDriftPpb; }
+	int64_t LastErrorUs() const { return mLastErrorUs; }
+	int64_t LastSyncUptimeUs() const { return mUptimeUs; }
+
+	uint64_t Now(int64_t uptimeUs) const
+	{
+		int64_t elapsedUs = uptimeUs - mUptimeUs;
+
+		return mUtcUs + elapsedUs + elapsedUs * mDriftPpb / 1000000000LL;
+	}
+
+	/* Returns the difference between the given time and the time the clock predicted. */
+	int64_t Sync(int64_t uptimeUs, uint64_t utcUs)
+	{
+		int64_t errorUs = 0;
+
+		if (mSynced) {
+			int64_t elapsedUs = uptimeUs - mUptimeUs;
+			int64_t absErrorUs;
+
+			errorUs = static_cast<int64_t>(utcUs - Now(uptimeUs));
+			absErrorUs = errorUs < 0 ? -errorUs : errorUs;
+
+			if (absErrorUs > kMinStepUs && absErrorUs > elapsedUs / (1000000000LL / kMaxErrorPpb)) {
+				mDriftPpb = 0;
+			} else if (elapsedUs >= kMinDriftIntervalUs) {
+				/*
+				 * Half of the error goes to the drift estimate, the rest is considered measurement jitter. The
+				 * error is bounded by the step check above, so it is scaled without overflowing, with the
+				 * interval in milliseconds.
+				 */
+				int64_t driftPpb = mDriftPpb + errorUs * 1000000LL / (elapsedUs / 1000) / 2;
+
+				mDriftPpb = static_cast<int32_t>(driftPpb > kMaxDriftPpb	? kMaxDriftPpb :
+								 driftPpb < -kMaxDriftPpb ? -kMaxDriftPpb :
+											    driftPpb);
+			}
+		}
+
+		mUptimeUs = uptimeUs;
+		mUtcUs = utcUs;
+		mLastErrorUs = errorUs;
+		mSynced = true;
+
+		return errorUs;
+	}
+
+	/* Doubles the synchronization interval while the error stays within the limit and halves it otherwise. */
+	static uint32_t NextIntervalS(uint32_t intervalS, int64_t errorUs, uint32_t maxErrorMs, uint32_t minIntervalS,
+				      uint32_t maxIntervalS)
+	{
+		int64_t absErrorUs = errorUs < 0 ? -errorUs : errorUs;
+		uint32_t next = absErrorUs <= static_cast<int64_t>(maxErrorMs) * 1000 ? intervalS * 2 : intervalS / 2;
+
+		return next < minIntervalS ? minIntervalS : next > maxIntervalS ? maxIntervalS : next;
+	}
+
+private:
+	bool mSynced{ false };
+	int64_t mUptimeUs{ 0 };
+	uint64_t mUtcUs{ 0 };
+	int32_t mDriftPpb{ 0 };
+	int64_t mLastErrorUs{ 0 };
+};
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "wifi_power.h"
+
+#include <zephyr/logging/log.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/wifi_mgmt.h>
+#include <zephyr/shell/shell.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+using namespace ::chip::DeviceLayer;
+
+namespace {
+
+constexpr WifiPowerPolicy::Config kWifiPowerPolicyConfig = { CONFIG_APP_WIFI_TWT_WAKE_DURATION_US,
+							     CONFIG_APP_WIFI_TWT_MIN_INTERVAL_MS,
+							     CONFIG_APP_WIFI_TWT_MAX_INTERVAL_MS,
+							     CONFIG_APP_WIFI_BEACON_INTERVAL_US,
+							     CONFIG_APP_WIFI_MAX_LISTEN_INTERVAL,
+							     CONFIG_APP_WIFI_POWER_CHANGE_THRESHOLD };
+
+const char *ModeName(WifiPowerPolicy::Mode mode)
+{
+	switch (mode) {
+	case WifiPowerPolicy::Mode::Twt:
+		return "TWT";
+	case WifiPowerPolicy::Mode::ListenInterval:
+		return "listen interval";
+	case WifiPowerPolicy::Mode::TwtPending:
+		return "TWT pending";
+	default:
+		return "DTIM";
+	}
+}
+
+/* TWT event passed to the Matter thread: flow ID in bits 0-7, followed by the event flags. */
+constexpr intptr_t kTwtEventAccepted = BIT(8);
+constexpr intptr_t kTwtEventTeardown = BIT(9);
+
+} /* namespace */
+
+int ZephyrWifiPowerBackend::SetupTwt(uint8_t flowId, uint64_t intervalUs, uint32_t wakeDurationUs)
+{
+	struct net_if *iface = net_if_get_first_wifi();
+	struct wifi_twt_params params = {};
+
+	params.operation = WIFI_TWT_SETUP;
+	params.negotiation_type = WIFI_TWT_INDIVIDUAL;
+	params.setup_cmd = WIFI_TWT_SETUP_CMD_REQUEST;
+	params.dialog_token = ++mDialogToken;
+	params.flow_id = flowId;
+	params.setup.twt_interval = intervalUs;
+	params.setup.twt_wake_interval = wakeDurationUs;
+	/* Unannounced, implicit TWT lets the station sleep without sending a frame at every service period. */
+	params.setup.implicit = true;
+	params.setup.announce = false;
+	params.setup.trigger = false;
+
+	return net_mgmt(NET_REQUEST_WIFI_TWT, iface, &params, sizeof(params));
+}
+
+int ZephyrWifiPowerBackend::TeardownTwt(uint8_t flowId)
+{
+	struct net_if *iface = net_if_get_first_wifi();
+	struct wifi_twt_params params = {};
+
+	params.operation = WIFI_TWT_TEARDOWN;
+	params.negotiation_type = WIFI_TWT_INDIVIDUAL;
+	params.dialog_token = ++mDialogToken;
+	params.flow_id = flowId;
+
+	return net_mgmt(NET_REQUEST_WIFI_TWT, iface, &params, sizeof(params));
+}
+
+int ZephyrWifiPowerBackend::SetListenInterval(uint16_t beacons)
+{
+	struct net_if *iface = net_if_get_first_wifi();
+	struct wifi_ps_params params = {};
+	int ret;
+
+	if (beacons > 0) {
+		params.type = WIFI_PS_PARAM_LISTEN_INTERVAL;
+		params.listen_interval = beacons;
+		ret = net_mgmt(NET_REQUEST_WIFI_PS, iface, &params, sizeof(params));
+		if (ret) {
+			return ret;
+		}
+	}
+
+	params.type = WIFI_PS_PARAM_WAKEUP_MODE;
+	params.wakeup_mode = beacons > 0 ? WIFI_PS_WAKEUP_MODE_LISTEN_INTERVAL : WIFI_PS_WAKEUP_MODE_DTIM;
+
+	return net_mgmt(NET_REQUEST_WIFI_PS, iface, &params, sizeof(params));
+}
+
+WifiPower::WifiPower() : mPolicy(mBackend, kWifiPowerPolicyConfig) {}
+
+CHIP_ERROR WifiPower::Init(uint32_t samplePeriodMs)
+{
+	mSamplePeriodMs = samplePeriodMs;
+
+	net_mgmt_init_event_callback(&mTwtCallback, TwtEventHandler, NET_EVENT_WIFI_TWT);
+	net_mgmt_add_event_callback(&mTwtCallback);
+
+	return PlatformMgr().AddEventHandler(EventHandler, 0);
+}
+
+void WifiPower::EventHandler(const ChipDeviceEvent *event, intptr_t arg)
+{
+	WifiPower &power = Instance();
+
+	if (event->Type != DeviceEventType::kWiFiConnectivityChange) {
+		return;
+	}
+
+	if (event->WiFiConnectivityChange.Result == kConnectivity_Established) {
+		power.mPolicy.OnConnected(power.mSamplePeriodMs);
+		power.UpdateTwtTimeout();
+	} else if (event->WiFiConnectivityChange.Result == kConnectivity_Lost) {
+		power.mPolicy.OnDisconnected();
+		power.UpdateTwtTimeout();
+	}
+}
+
+void WifiPower::TwtEventHandler(struct net_mgmt_event_callback *cb, uint32_t event, struct net_if *iface)
+{
+	const struct wifi_twt_params *params = static_cast<const struct wifi_twt_params *>(cb->info);
+	intptr_t context;
+
+	if (event != NET_EVENT_WIFI_TWT || params == nullptr) {
+		return;
+	}
+
+	context = params->flow_id;
+
+	if (params->operation == WIFI_TWT_TEARDOWN) {
+		context |= kTwtEventTeardown;
+	} else if (params->resp_status == WIFI_TWT_RESP_RECEIVED && params->setup_cmd == WIFI_TWT_SETUP_CMD_ACCEPT) {
+		context |= kTwtEventAccepted;
+	}
+
+	/* Runs in the network management thread, the policy is only accessed from the Matter thread. */
+	PlatformMgr().ScheduleWork(TwtEventWork, context);
+}
+
+void WifiPower::TwtEventWork(intptr_t context)
+{
+	WifiPower &power = Instance();
+	uint8_t flowId = static_cast<uint8_t>(context & UINT8_MAX);
+
+	if (context & kTwtEventTeardown) {
+		power.mPolicy.OnTwtTeardown(flowId);
+	} else {
+		power.mPolicy.OnTwtSetupResult(flowId, context & kTwtEventAccepted);
+	}
+
+	power.UpdateTwtTimeout();
+}
+
+void WifiPower::TwtTimeoutHandler(System::Layer *layer, void *context)
+{
+	WifiPower &power = Instance();
+
+	LOG_WRN("No TWT response from the access point");
+	power.mPolicy.OnTwtSetupResult(power.mPolicy.GetFlowId(), false);
+	power.UpdateTwtTimeout();
+}
+
+void WifiPower::UpdateTwtTimeout()
+{
+	WifiPowerPolicy::Mode mode = mPolicy.GetMode();
+
+	/* Every request uses a new flow ID, the timer is only restarted for a new request. */
+	if (mode != WifiPowerPolicy::Mode::TwtPending) {
+		SystemLayer().CancelTimer(TwtTimeoutHandler, this);
+		mTimedFlowId = kNoFlowId;
+	} else if (mTimedFlowId != mPolicy.GetFlowId()) {
+		SystemLayer().CancelTimer(TwtTimeoutHandler, this);
+		SystemLayer().StartTimer(System::Clock::Milliseconds32(CONFIG_APP_WIFI_TWT_RESPONSE_TIMEOUT_MS),
+					 TwtTimeoutHandler, this);
+		mTimedFlowId = mPolicy.GetFlowId();
+	}
+
+	if (mode != mLoggedMode) {
+		mLoggedMode = mode;
+		LOG_INF("Wi-Fi power save: %s, interval %u ms", ModeName(mode), mPolicy.GetIntervalMs());
+	}
+}
+
+void WifiPower::OnSample(uint32_t samplePeriodMs)
+{
+	if (samplePeriodMs != mSamplePeriodMs) {
+		PlatformMgr().ScheduleWork(SampleWork, static_cast<intptr_t>(samplePeriodMs));
+	}
+}
+
+void WifiPower::SampleWork(intptr_t context)
+{
+	WifiPower &power = Instance();
+
+	power.mSamplePeriodMs = static_cast<uint32_t>(context);
+	power.mPolicy.OnSamplePeriodChanged(power.mSamplePeriodMs);
+	power.UpdateTwtTimeout();
+}
+
+#ifdef CONFIG_SHELL
+void WifiPower::Print(const struct shell *shell)
+{
+	shell_print(shell, "mode: %s, interval: %u ms, sample period: %u ms", ModeName(mPolicy.GetMode()),
+		    mPolicy.GetIntervalMs(), mSamplePeriodMs);
+	shell_print(shell, "renegotiations: %u, TWT failures: %u", mPolicy.Renegotiations(), mPolicy.TwtFailures());
+}
+
+static int WifiPowerShowHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::StackLock lock;
+
+	WifiPower::Instance().Print(shell);
+	return 0;
+}
+
+SHELL_SUBCMD_ADD((app), wifi_power, NULL, "Print Wi-Fi power save state", WifiPowerShowHandler, 1, 0);
+#endif /* CONFIG_SHELL */
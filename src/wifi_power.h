@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include "wifi_power_policy.h"
+
+#include <platform/CHIPDeviceLayer.h>
+
+#include <zephyr/net/net_mgmt.h>
+
+struct shell;
+
+/* WifiPowerBackend issuing network management requests to the first Wi-Fi interface. */
+class ZephyrWifiPowerBackend : public WifiPowerBackend {
+public:
+	int SetupTwt(uint8_t flowId, uint64_t intervalUs, uint32_t wakeDurationUs) override;
+	int TeardownTwt(uint8_t flowId) override;
+	int SetListenInterval(uint16_t beacons) override;
+
+private:
+	uint8_t mDialogToken{ 0 };
+};
+
+/*
+ * Applies WifiPowerPolicy on Wi-Fi connectivity changes and sample period changes. The TWT responses of the access
+ * point are received as NET_EVENT_WIFI_TWT network management events and passed to the policy on the Matter thread.
+ */
+class WifiPower {
+public:
+	static WifiPower &Instance()
+	{
+		static WifiPower sWifiPower;
+		return sWifiPower;
+	}
+
+	CHIP_ERROR Init(uint32_t samplePeriodMs);
+	void Print(const struct shell *shell);
+
+	/* Thread-safe, called by the sensor thread after every sample. */
+	void OnSample(uint32_t samplePeriodMs);
+
+private:
+	WifiPower();
+
+	static void EventHandler(const chip::DeviceLayer::ChipDeviceEvent *event, intptr_t arg);
+	static void TwtEventHandler(struct net_mgmt_event_callback *cb, uint32_t event, struct net_if *iface);
+	static void TwtEventWork(intptr_t context);
+	static void TwtTimeoutHandler(chip::System::Layer *layer, void *context);
+	static void SampleWork(intptr_t context);
+
+	void UpdateTwtTimeout();
+
+	static constexpr int16_t kNoFlowId = -1;
+
+	struct net_mgmt_event_callback mTwtCallback;
+	ZephyrWifiPowerBackend mBackend;
+	WifiPowerPolicy mPolicy;
+	uint32_t mSamplePeriodMs{ 0 };
+	int16_t mTimedFlowId{ kNoFlowId };
+	WifiPowerPolicy::Mode mLoggedMode{ WifiPowerPolicy::Mode::Dtim };
+};
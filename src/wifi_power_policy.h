@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * Wi-Fi management operations used by the power policy. The Zephyr implementation issues network management
+ * requests to the Wi-Fi interface, a stub implementation can be used to exercise the policy off-target.
+ */
+class WifiPowerBackend {
+public:
+	virtual ~WifiPowerBackend() = default;
+
+	/*
+	 * Returns 0 if the request was sent, negative error code otherwise. The response of the access point arrives
+	 * later and is passed to WifiPowerPolicy::OnTwtSetupResult().
+	 */
+	virtual int SetupTwt(uint8_t flowId, uint64_t intervalUs, uint32_t wakeDurationUs) = 0;
+	virtual int TeardownTwt(uint8_t flowId) = 0;
+	/* Listen interval in beacon intervals, 0 restores DTIM based wake-ups. */
+	virtual int SetListenInterval(uint16_t beacons) = 0;
+};
+
+/*
+ * Selects the Wi-Fi power save schedule from the sensor sampling cadence. Individual TWT is negotiated with a service
+ * period interval equal to the sample period, so the radio wakes up together with the sensor. The access point answers
+ * the TWT setup request asynchronously. If it rejects TWT, does not answer or tears the agreement down, the listen
+ * interval closest to the sample period is used instead. The schedule is renegotiated when the sample period changes
+ * by more than the configured threshold. Every negotiation uses the next flow ID, so late responses to a previous
+ * request are ignored.
+ */
+class WifiPowerPolicy {
+public:
+	enum class Mode : uint8_t { Dtim, ListenInterval, TwtPending, Twt };
+
+	struct Config {
+		uint32_t mWakeDurationUs;
+		uint32_t mMinTwtIntervalMs;
+		uint32_t mMaxTwtIntervalMs;
+		uint32_t mBeaconIntervalUs;
+		uint16_t mMaxListenInterval;
+		uint8_t mChangeThresholdPercent;
+	};
+
+	/* TWT flow IDs are 3 bits wide. */
+	static constexpr uint8_t kFlowIdCount = 8;
+
+	WifiPowerPolicy(WifiPowerBackend &backend, const Config &config) : mBackend(backend), mConfig(config) {}
+
+	Mode GetMode() const { return mMode; }
+	uint32_t GetIntervalMs() const { return mIntervalMs; }
+	uint8_t GetFlowId() const { return mFlowId; }
+	uint32_t Renegotiations() const { return mRenegotiations; }
+	uint32_t TwtFailures() const { return mTwtFailures; }
+
+	void OnConnected(uint32_t samplePeriodMs)
+	{
+		mConnected = true;
+		mTwtRejected = false;
+		mSamplePeriodMs = samplePeriodMs;
+		Negotiate();
+	}
+
+	void OnDisconnected()
+	{
+		/* The access point drops the agreements on disconnection. */
+		mConnected = false;
+		mMode = Mode::Dtim;
+		mIntervalMs = 0;
+	}
+
+	void OnSamplePeriodChanged(uint32_t samplePeriodMs)
+	{
+		mSamplePeriodMs = samplePeriodMs;
+
+		/* A change during a negotiation is handled once the access point has answered. */
+		if (!mConnected || mMode == Mode::TwtPending || !ExceedsThreshold(samplePeriodMs)) {
+			return;
+		}
+
+		Renegotiate();
+	}
+
+	/* Response of the access point to a TWT setup request, or a rejection if no response arrived in time. */
+	void OnTwtSetupResult(uint8_t flowId, bool accepted)
+	{
+		if (mMode != Mode::TwtPending || flowId != mFlowId) {
+			return;
+		}
+
+		if (!accepted) {
+			/* Do not retry TWT with an access point that has rejected it until the next connection. */
+			mTwtRejected = true;
+			mTwtFailures++;
+			FallBack(Clamp(mSamplePeriodMs));
+			return;
+		}
+
+		mMode = Mode::Twt;
+
+		if (ExceedsThreshold(mSamplePeriodMs)) {
+			Renegotiate();
+		}
+	}
+
+	/* The access point has ended the agreement. */
+	void OnTwtTeardown(uint8_t flowId)
+	{
+		if (mMode != Mode::Twt || flowId != mFlowId) {
+			return;
+		}
+
+		mTwtRejected = true;
+		mTwtFailures++;
+		FallBack(Clamp(mSamplePeriodMs));
+	}
+
+private:
+	bool ExceedsThreshold(uint32_t samplePeriodMs) const
+	{
+		uint32_t target = Clamp(samplePeriodMs);
+		uint32_t change = target > mIntervalMs ? target - mIntervalMs : mIntervalMs - target;
+
+		return mIntervalMs == 0 ||
+		       static_cast<uint64_t>(change) * 100 > static_cast<uint64_t>(mIntervalMs) * mConfig.mChangeThresholdPercent;
+	}
+
+	uint32_t Clamp(uint32_t samplePeriodMs) const
+	{
+		if (samplePeriodMs < mConfig.mMinTwtIntervalMs) {
+			return mConfig.mMinTwtIntervalMs;
+		}
+
+		return samplePeriodMs > mConfig.mMaxTwtIntervalMs ? mConfig.mMaxTwtIntervalMs : samplePeriodMs;
+	}
+
+	void Renegotiate()
+	{
+		if (mMode == Mode::Twt) {
+			mBackend.TeardownTwt(mFlowId);
+		}
+
+		mRenegotiations++;
+		Negotiate();
+	}
+
+	void Negotiate()
+	{
+		uint32_t intervalMs = Clamp(mSamplePeriodMs);
+
+		if (!mTwtRejected) {
+			uint64_t intervalUs = static_cast<uint64_t>(intervalMs) * 1000;
+
+			mFlowId = (mFlowId + 1) % kFlowIdCount;
+
+			if (mBackend.SetupTwt(mFlowId, intervalUs, mConfig.mWakeDurationUs) == 0) {
+				mMode = Mode::TwtPending;
+				mIntervalMs = intervalMs;
+				return;
+			}
+
+			mTwtRejected = true;
+			mTwtFailures++;
+		}
+
+		FallBack(intervalMs);
+	}
+
+	void FallBack(uint32_t intervalMs)
+	{
+		uint32_t beacons = static_cast<uint32_t>(static_cast<uint64_t>(intervalMs) * 1000 / mConfig.mBeaconIntervalUs);
+
+		if (beacons > mConfig.mMaxListenInterval) {
+			beacons = mConfig.mMaxListenInterval;
+		}
+
+		if (beacons > 1 && mBackend.SetListenInterval(static_cast<uint16_t>(beacons)) == 0) {
+			mMode = Mode::ListenInterval;
+			mIntervalMs = static_cast<uint32_t>(static_cast<uint64_t>(beacons) * mConfig.mBeaconIntervalUs / 1000);
+			return;
+		}
+
+		mBackend.SetListenInterval(0);
+		mMode = Mode::Dtim;
+		mIntervalMs = intervalMs;
+	}
+
+	WifiPowerBackend &mBackend;
+	Config mConfig;
+	Mode mMode{ Mode::Dtim };
+	uint32_t mIntervalMs{ 0 };
+	uint32_t mSamplePeriodMs{ 0 };
+	uint8_t mFlowId{ 0 };
+	bool mConnected{ false };
+	bool mTwtRejected{ false };
+	uint32_t mRenegotiations{ 0 };
+	uint32_t mTwtFailures{ 0 };
+};
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "bt_ess_state.h"
+
+#include <zephyr/ztest.h>
+
+namespace {
+
+/* Stands for struct bt_conn, only the addresses are compared. */
+struct Conn {
+	int mId;
+};
+
+using State = BtEssState<Conn>;
+
+Conn sClient{ 1 };
+Conn sCommissioner{ 2 };
+
+} /* namespace */
+
+ZTEST(bt_ess_state, test_connection_while_advertising)
+{
+	State state;
+
+	state.OnAdvertising(true);
+
+	zassert_true(state.OnConnected(&sClient, true));
+	zassert_equal(state.GetConnection(), &sClient);
+	zassert_false(state.IsAdvertising());
+	zassert_equal(state.GetConnections(), 1);
+}
+
+ZTEST(bt_ess_state, test_connection_of_another_service)
+{
+	State state;
+
+	/* The Matter commissioning advertising was running, not the one of the service. */
+	zassert_false(state.OnConnected(&sCommissioner, true));
+	zassert_is_null(state.GetConnection());
+
+	/* A central connection of the device is never one of the service. */
+	state.OnAdvertising(true);
+	zassert_false(state.OnConnected(&sCommissioner, false));
+	zassert_is_null(state.GetConnection());
+	zassert_equal(state.GetConnections(), 0);
+}
+
+ZTEST(bt_ess_state, test_single_connection)
+{
+	State state;
+
+	state.OnAdvertising(true);
+	zassert_true(state.OnConnected(&sClient, true));
+
+	/* The arbiter may restart the advertising before the request is cancelled. */
+	state.OnAdvertising(true);
+	zassert_false(state.OnConnected(&sCommissioner, true));
+	zassert_equal(state.GetConnection(), &sClient);
+}
+
+ZTEST(bt_ess_state, test_disconnection)
+{
+	State state;
+
+	state.OnAdvertising(true);
+	zassert_true(state.OnConnected(&sClient, true));
+
+	/* Another connection going away does not release the service. */
+	zassert_false(state.OnDisconnected(&sCommissioner));
+	zassert_equal(state.GetConnection(), &sClient);
+
+	zassert_true(state.OnDisconnected(&sClient));
+	zassert_is_null(state.GetConnection());
+
+	/* The request is inserted again once only. */
+	zassert_false(state.OnDisconnected(&sClient));
+}
+
+ZTEST(bt_ess_state, test_ccc_requires_connection)
+{
+	State state;
+
+	/* A subscription written over the commissioning connection is ignored. */
+	state.OnCccChanged(State::kTemperature, true);
+	zassert_false(state.ShouldNotify(State::kTemperature));
+	zassert_false(state.IsSubscribed());
+
+	state.OnAdvertising(true);
+	zassert_true(state.OnConnected(&sClient, true));
+	zassert_false(state.IsSubscribed());
+
+	state.OnCccChanged(State::kHumidity, true);
+	zassert_false(state.ShouldNotify(State::kTemperature));
+	zassert_true(state.ShouldNotify(State::kHumidity));
+	zassert_true(state.IsSubscribed());
+
+	state.OnCccChanged(State::kHumidity, false);
+	zassert_false(state.IsSubscribed());
+}
+
+ZTEST(bt_ess_state, test_subscription_ends_with_connection)
+{
+	State state;
+
+	state.OnAdvertising(true);
+	zassert_true(state.OnConnected(&sClient, true));
+	state.OnCccChanged(State::kTemperature, true);
+	state.OnCccChanged(State::kHumidity, true);
+	zassert_true(state.IsSubscribed());
+
+	zassert_true(state.OnDisconnected(&sClient));
+	zassert_false(state.IsSubscribed());
+
+	/* A new client starts unsubscribed. */
+	state.OnAdvertising(true);
+	zassert_true(state.OnConnected(&sClient, true));
+	zassert_false(state.ShouldNotify(State::kTemperature));
+	zassert_false(state.ShouldNotify(State::kHumidity));
+	zassert_equal(state.GetConnections(), 2);
+}
+
+ZTEST_SUITE(bt_ess_state, NULL, NULL, NULL, NULL, NULL);
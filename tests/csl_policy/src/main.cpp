@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "csl_policy.h"
+
+#include <zephyr/ztest.h>
+
+ZTEST(csl_policy, test_period_disabled)
+{
+	zassert_equal(CslPolicy::PeriodUs(0, 5000), 0);
+	zassert_equal(CslPolicy::PeriodUs(10000, 0), 0);
+}
+
+ZTEST(csl_policy, test_period_divides_sample_period)
+{
+	/* 10 s split in two windows of 5 s, which is a whole number of CSL units. */
+	zassert_equal(CslPolicy::PeriodUs(10000, 5000), 5000000);
+
+	/* A sample period below the maximum is used as is. */
+	zassert_equal(CslPolicy::PeriodUs(4000, 5000), 4000000);
+
+	for (uint32_t samplePeriodMs = 1000; samplePeriodMs <= 60000; samplePeriodMs += 700) {
+		uint32_t periodUs = CslPolicy::PeriodUs(samplePeriodMs, 5000);
+
+		zassert_true(periodUs <= 5000000, "%u ms: %u us", samplePeriodMs, periodUs);
+		zassert_equal(periodUs % CslPolicy::kUnitUs, 0, "%u ms: %u us", samplePeriodMs, periodUs);
+	}
+}
+
+ZTEST(csl_policy, test_period_without_exact_division)
+{
+	/* 7001 ms has no window count below 4 giving whole CSL units, the period is rounded down to a unit. */
+	uint32_t periodUs = CslPolicy::PeriodUs(7001, 5000);
+
+	zassert_equal(periodUs % CslPolicy::kUnitUs, 0);
+	zassert_true(periodUs <= 3500500);
+	zassert_true(periodUs > 3500500 - CslPolicy::kUnitUs);
+}
+
+ZTEST(csl_policy, test_align_on_grid)
+{
+	/* The next sample already falls on a window. */
+	zassert_equal(CslPolicy::AlignDelayUs(1000000, 0, 500000, 10000000), 10000000);
+}
+
+ZTEST(csl_policy, test_align_nearest_window)
+{
+	/* 100 ms after a window: the sample is moved back. */
+	zassert_equal(CslPolicy::AlignDelayUs(1100000, 0, 500000, 10000000), 9900000);
+
+	/* 100 ms before a window: the sample is moved forward. */
+	zassert_equal(CslPolicy::AlignDelayUs(1400000, 0, 500000, 10000000), 10100000);
+
+	/* Anchored in the middle of the uptime. */
+	zassert_equal(CslPolicy::AlignDelayUs(5000000, 4990000, 1000000, 3000000), 2990000);
+}
+
+ZTEST(csl_policy, test_align_not_before_now)
+{
+	/* The nearest window is before the current time, the next one is used. */
+	zassert_equal(CslPolicy::AlignDelayUs(1300000, 0, 1000000, 100000), 700000);
+}
+
+ZTEST(csl_policy, test_align_keeps_cadence)
+{
+	uint64_t now = 123456;
+	uint64_t anchor = 0;
+	uint32_t periodUs = CslPolicy::PeriodUs(10000, 5000);
+
+	/* Once aligned, samples with a period that is a multiple of the CSL period stay on the grid. */
+	now += CslPolicy::AlignDelayUs(now, anchor, periodUs, 10000000);
+	zassert_equal((now - anchor) % periodUs, 0);
+
+	for (int i = 0; i < 10; i++) {
+		zassert_equal(CslPolicy::AlignDelayUs(now, anchor, periodUs, 10000000), 10000000);
+		now += 10000000;
+	}
+}
+
+ZTEST(csl_policy, test_align_without_grid)
+{
+	zassert_equal(CslPolicy::AlignDelayUs(1000, 0, 0, 5000), 5000);
+	zassert_equal(CslPolicy::AlignDelayUs(1000, 2000, 300, 5000), 5000);
+}
+
+ZTEST(csl_policy, test_radio_on)
+{
+	zassert_equal(CslPolicy::RadioOnMsPerHour(0, 1000), 0);
+
+	/* One window of 1 ms per second. */
+	zassert_equal(CslPolicy::RadioOnMsPerHour(1000000, 1000), 3600);
+}
+
+ZTEST_SUITE(csl_policy, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "time_sync_clock.h"
+
+#include <zephyr/ztest.h>
+
+namespace {
+
+constexpr int64_t kSecondUs = 1000LL * 1000;
+constexpr int64_t kHourUs = 3600 * kSecondUs;
+constexpr uint64_t kUtcUs = 800000000ULL * kSecondUs;
+
+} /* namespace */
+
+ZTEST(drift_clock, test_first_sync)
+{
+	DriftClock clock;
+
+	zassert_false(clock.IsSynced());
+	zassert_equal(clock.Sync(10 * kSecondUs, kUtcUs), 0);
+	zassert_true(clock.IsSynced());
+	zassert_equal(clock.Now(20 * kSecondUs), kUtcUs + 10 * kSecondUs);
+}
+
+ZTEST(drift_clock, test_drift_estimate)
+{
+	DriftClock clock;
+	int64_t uptimeUs = 0;
+	uint64_t utcUs = kUtcUs;
+
+	/* The local clock runs 100 ppm slow: the source advances 1.0001 s per local second. */
+	clock.Sync(uptimeUs, utcUs);
+	for (int i = 0; i < 20; i++) {
+		uptimeUs += kHourUs;
+		utcUs += kHourUs + kHourUs / 10000;
+		clock.Sync(uptimeUs, utcUs);
+	}
+
+	zassert_within(clock.DriftPpb(), 100000, 1000);
+	zassert_within(clock.LastErrorUs(), 0, 5000);
+}
+
+ZTEST(drift_clock, test_short_interval_ignored)
+{
+	DriftClock clock;
+
+	clock.Sync(0, kUtcUs);
+	clock.Sync(10 * kSecondUs, kUtcUs + 10 * kSecondUs + 500000);
+
+	zassert_equal(clock.DriftPpb(), 0);
+	zassert_equal(clock.LastErrorUs(), 500000);
+}
+
+ZTEST(drift_clock, test_time_step_resets_drift)
+{
+	DriftClock clock;
+	int64_t errorUs;
+
+	clock.Sync(0, kUtcUs);
+	clock.Sync(kHourUs, kUtcUs + kHourUs + kHourUs / 10000);
+	zassert_true(clock.DriftPpb() > 0);
+
+	/* The source was set 3 hours ahead, which used to overflow the drift computation. */
+	errorUs = clock.Sync(2 * kHourUs, kUtcUs + 5 * kHourUs);
+	zassert_true(errorUs > 2 * kHourUs);
+	zassert_equal(clock.DriftPpb(), 0);
+	zassert_equal(clock.Now(2 * kHourUs), kUtcUs + 5 * kHourUs);
+
+	/* And back. */
+	clock.Sync(3 * kHourUs, kUtcUs + kHourUs);
+	zassert_equal(clock.DriftPpb(), 0);
+}
+
+ZTEST(drift_clock, test_drift_clamped)
+{
+	DriftClock clock;
+
+	/* 0.9 ms per second is below the step limit but above the maximum drift. */
+	clock.Sync(0, kUtcUs);
+	clock.Sync(kHourUs, kUtcUs + kHourUs + kHourUs * 9 / 10000);
+	zassert_equal(clock.DriftPpb(), 450000);
+
+	clock.Sync(2 * kHourUs, kUtcUs + 2 * kHourUs + 2 * kHourUs * 9 / 10000);
+	zassert_equal(clock.DriftPpb(), DriftClock::kMaxDriftPpb);
+}
+
+ZTEST(drift_clock, test_next_interval)
+{
+	zassert_equal(DriftClock::NextIntervalS(60, 1000, 100, 60, 3600), 120);
+	zassert_equal(DriftClock::NextIntervalS(2400, -1000, 100, 60, 3600), 3600);
+	zassert_equal(DriftClock::NextIntervalS(120, 200000, 100, 60, 3600), 60);
+	zassert_equal(DriftClock::NextIntervalS(60, -200000, 100, 60, 3600), 60);
+}
+
+ZTEST_SUITE(drift_clock, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "poll_policy.h"
+
+#include <zephyr/ztest.h>
+
+namespace {
+
+constexpr PollPolicy::Config kConfig = { 200, 1000, 30000, 2000, 3000 };
+
+} /* namespace */
+
+ZTEST(poll_policy, test_idle_without_sample)
+{
+	PollPolicy policy(kConfig);
+
+	/* Nothing is expected and no sample is scheduled, so the minimum slow interval is used. */
+	zassert_false(policy.IsFast(0));
+	zassert_equal(policy.Interval(0), 1000);
+}
+
+ZTEST(poll_policy, test_report_window)
+{
+	PollPolicy policy(kConfig);
+
+	policy.OnSample(1000, 10000, true);
+
+	zassert_true(policy.IsFast(1000));
+	zassert_equal(policy.Interval(1500), 200);
+	zassert_equal(policy.NextEvaluationInMs(1500), 1500);
+
+	/* The report window ends without a report. */
+	zassert_equal(policy.Interval(3000), 8000);
+}
+
+ZTEST(poll_policy, test_unchanged_sample)
+{
+	PollPolicy policy(kConfig);
+
+	/* A sample within the deadband is not reported, the slow interval is stretched up to the next sample. */
+	policy.OnSample(1000, 10000, false);
+
+	zassert_false(policy.IsFast(1000));
+	zassert_equal(policy.Interval(1500), 9500);
+
+	/* It does not cut short the window of an earlier sample that changed a value either. */
+	policy.OnSample(11000, 10000, true);
+	policy.OnSample(12000, 10000, false);
+	zassert_true(policy.IsFast(12500));
+	zassert_false(policy.IsFast(13000));
+}
+
+ZTEST(poll_policy, test_report_sent)
+{
+	PollPolicy policy(kConfig);
+
+	policy.OnSample(0, 10000, true);
+	policy.OnReportSent();
+
+	/* The slow interval is stretched up to the next sample. */
+	zassert_equal(policy.Interval(100), 9900);
+	zassert_equal(policy.NextEvaluationInMs(100), 9900);
+}
+
+ZTEST(poll_policy, test_slow_interval_bounds)
+{
+	PollPolicy policy(kConfig);
+
+	policy.OnSample(0, 60000, true);
+	policy.OnReportSent();
+	zassert_equal(policy.Interval(0), 30000);
+
+	policy.OnSample(0, 500, true);
+	policy.OnReportSent();
+	zassert_equal(policy.Interval(0), 1000);
+
+	/* The sample is overdue. */
+	zassert_equal(policy.Interval(800), 1000);
+}
+
+ZTEST(poll_policy, test_ack)
+{
+	PollPolicy policy(kConfig);
+
+	policy.OnAckExpected(0);
+	policy.OnAckExpected(100);
+	zassert_true(policy.IsFast(200));
+
+	policy.OnAckReceived();
+	zassert_true(policy.IsFast(200));
+
+	policy.OnAckReceived();
+	zassert_false(policy.IsFast(200));
+
+	/* An unmatched acknowledgement does not underflow the counter. */
+	policy.OnAckReceived();
+	zassert_false(policy.IsFast(200));
+}
+
+ZTEST(poll_policy, test_ack_timeout)
+{
+	PollPolicy policy(kConfig);
+
+	policy.OnAckExpected(0);
+
+	zassert_true(policy.IsFast(2999));
+	zassert_equal(policy.NextEvaluationInMs(1000), 2000);
+	zassert_false(policy.IsFast(3000));
+}
+
+ZTEST(poll_policy, test_report_and_ack_deadline)
+{
+	PollPolicy policy(kConfig);
+
+	/* Fast polling lasts until the later of the report window and the acknowledgement timeout. */
+	policy.OnSample(0, 10000, true);
+	policy.OnAckExpected(500);
+	zassert_equal(policy.NextEvaluationInMs(500), 3000);
+
+	policy.OnSample(10000, 10000, true);
+	policy.OnAckExpected(9000);
+	zassert_equal(policy.NextEvaluationInMs(10000), 2000);
+}
+
+ZTEST(poll_policy, test_wrap_around)
+{
+	PollPolicy policy(kConfig);
+	uint32_t now = UINT32_MAX - 500;
+
+	policy.OnSample(now, 10000, true);
+	zassert_true(policy.IsFast(now + 1000));
+	zassert_false(policy.IsFast(now + 2000));
+
+	policy.OnReportSent();
+	zassert_equal(policy.Interval(now + 2000), 8000);
+}
+
+ZTEST_SUITE(poll_policy, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "rtt_estimator.h"
+
+#include <zephyr/ztest.h>
+
+namespace {
+
+constexpr uint32_t kMinRtoMs = 100;
+constexpr uint32_t kMaxRtoMs = 5000;
+
+/*
+ * Loopback link between the device and one peer. Every message is acknowledged after the base delay plus a
+ * deterministic jitter, and is retransmitted when the acknowledgement does not arrive within the retransmission
+ * timeout. The messages go through an RttSampler as in AdaptiveMrp: they are tracked when sent, every retransmission
+ * is reported as the reliable messaging layer does, and the acknowledgement yields the sample.
+ */
+class LoopbackLink {
+public:
+	LoopbackLink(uint32_t delayMs, uint32_t jitterMs) : mDelayMs(delayMs), mJitterMs(jitterMs) {}
+
+	void SetDelay(uint32_t delayMs) { mDelayMs = delayMs; }
+
+	/* Sends one message and returns the number of retransmissions it needed. */
+	uint32_t Exchange(RttEstimator &estimator)
+	{
+		uint32_t rtt = mDelayMs + NextJitter();
+		uint32_t rto = estimator.HasSamples() ? estimator.RtoMs(kMinRtoMs, kMaxRtoMs) : kMaxRtoMs;
+		/* An acknowledgement arriving exactly at the timeout wins the race with the retransmission. */
+		uint32_t retransmissions = rtt > rto ? (rtt - 1) / rto : 0;
+		uint32_t counter = mCounter++;
+		uint32_t sample;
+
+		mSampler.Track(kSessionId, counter, mNowMs);
+
+		for (uint32_t i = 0; i < retransmissions; i++) {
+			mSampler.MarkRetransmitted(counter);
+		}
+
+		mNowMs += rtt;
+
+		if (mSampler.Acknowledge(kSessionId, counter, mNowMs, sample)) {
+			estimator.AddSample(sample);
+		}
+
+		return retransmissions;
+	}
+
+private:
+	uint32_t NextJitter()
+	{
+		if (mJitterMs == 0) {
+			return 0;
+		}
+
+		/* Linear congruential generator, so every run sees the same sequence. */
+		mSeed = mSeed * 1103515245u + 12345u;
+		return (mSeed >> 16) % (mJitterMs + 1);
+	}
+
+	static constexpr uint16_t kSessionId = 1;
+
+	RttSampler<4> mSampler;
+	uint32_t mDelayMs;
+	uint32_t mJitterMs;
+	uint32_t mSeed{ 1 };
+	uint32_t mCounter{ 0 };
+	uint32_t mNowMs{ 0 };
+};
+
+} /* namespace */
+
+ZTEST(rtt_estimator, test_first_sample)
+{
+	RttEstimator estimator;
+
+	zassert_false(estimator.HasSamples());
+
+	estimator.AddSample(400);
+
+	/* RFC 6298: SRTT = R, RTTVAR = R / 2. */
+	zassert_equal(estimator.Samples(), 1);
+	zassert_equal(estimator.SrttMs(), 400);
+	zassert_equal(estimator.RttvarMs(), 200);
+	zassert_equal(estimator.RtoMs(0, UINT32_MAX), 1200);
+}
+
+ZTEST(rtt_estimator, test_rto_bounds)
+{
+	RttEstimator estimator;
+
+	estimator.AddSample(5);
+	zassert_equal(estimator.RtoMs(kMinRtoMs, kMaxRtoMs), kMinRtoMs);
+
+	estimator.Reset();
+	estimator.AddSample(10000);
+	zassert_equal(estimator.RtoMs(kMinRtoMs, kMaxRtoMs), kMaxRtoMs);
+}
+
+ZTEST(rtt_estimator, test_reset)
+{
+	RttEstimator estimator;
+
+	estimator.AddSample(300);
+	estimator.Reset();
+
+	zassert_false(estimator.HasSamples());
+	zassert_equal(estimator.SrttMs(), 0);
+	zassert_equal(estimator.RttvarMs(), 0);
+}
+
+ZTEST(rtt_estimator, test_sampler_karn)
+{
+	RttSampler<2> sampler;
+	uint32_t rtt = 0;
+
+	/* The acknowledgement of a message sent once yields a sample. */
+	zassert_true(sampler.Track(1, 10, 1000));
+	zassert_true(sampler.Acknowledge(1, 10, 1300, rtt));
+	zassert_equal(rtt, 300);
+
+	/* A retransmitted message does not, as the acknowledgement may belong to either transmission. */
+	zassert_true(sampler.Track(1, 11, 2000));
+	zassert_true(sampler.MarkRetransmitted(11));
+	zassert_false(sampler.Acknowledge(1, 11, 2900, rtt));
+
+	/* Acknowledgements on another session, or of messages no longer tracked, are ignored. */
+	zassert_true(sampler.Track(1, 12, 3000));
+	zassert_false(sampler.Acknowledge(2, 12, 3100, rtt));
+	zassert_false(sampler.Acknowledge(1, 11, 3100, rtt));
+	zassert_false(sampler.MarkRetransmitted(11));
+
+	/* A message given up by MRP is released. */
+	sampler.Release(12);
+	zassert_false(sampler.Acknowledge(1, 12, 3200, rtt));
+}
+
+ZTEST(rtt_estimator, test_sampler_overflow)
+{
+	RttSampler<2> sampler;
+	uint32_t rtt = 0;
+
+	zassert_true(sampler.Track(1, 1, 100));
+	zassert_true(sampler.Track(1, 2, 200));
+
+	/* The oldest message makes room for the new one. */
+	zassert_false(sampler.Track(1, 3, 300));
+	zassert_false(sampler.Acknowledge(1, 1, 400, rtt));
+	zassert_true(sampler.Acknowledge(1, 2, 400, rtt));
+	zassert_equal(rtt, 200);
+	zassert_true(sampler.Acknowledge(1, 3, 400, rtt));
+	zassert_equal(rtt, 100);
+}
+
+ZTEST(rtt_estimator, test_loopback_constant_delay)
+{
+	RttEstimator estimator;
+	LoopbackLink link(250, 0);
+
+	for (int i = 0; i < 50; i++) {
+		zassert_equal(link.Exchange(estimator), 0);
+	}
+
+	/* Without jitter the variance decays and the timeout approaches the round-trip time. */
+	zassert_equal(estimator.SrttMs(), 250);
+	zassert_true(estimator.RttvarMs() <= 1, "rttvar %u", estimator.RttvarMs());
+	zassert_true(estimator.RtoMs(kMinRtoMs, kMaxRtoMs) <= 254);
+}
+
+ZTEST(rtt_estimator, test_loopback_jitter)
+{
+	RttEstimator estimator;
+	LoopbackLink link(300, 200);
+	uint32_t retransmissions = 0;
+
+	for (int i = 0; i < 20; i++) {
+		link.Exchange(estimator);
+	}
+
+	for (int i = 0; i < 500; i++) {
+		retransmissions += link.Exchange(estimator);
+	}
+
+	/* The timeout covers the delay spread, so spurious retransmissions stay rare once the estimator settled. */
+	zassert_true(retransmissions < 10, "%u retransmissions", retransmissions);
+	zassert_within(estimator.SrttMs(), 400, 60);
+	zassert_true(estimator.RtoMs(kMinRtoMs, kMaxRtoMs) >= 500);
+}
+
+ZTEST(rtt_estimator, test_loopback_delay_step)
+{
+	RttEstimator estimator;
+	LoopbackLink link(200, 0);
+
+	for (int i = 0; i < 30; i++) {
+		link.Exchange(estimator);
+	}
+
+	/* The timeout is well below the new delay, the first exchanges are retransmitted and not sampled. */
+	link.SetDelay(1500);
+	zassert_true(link.Exchange(estimator) > 0);
+	zassert_equal(estimator.SrttMs(), 200);
+
+	/* Once a sample gets through, the variance term lifts the timeout above the new delay right away. */
+	estimator.AddSample(1500);
+	zassert_true(estimator.RtoMs(kMinRtoMs, kMaxRtoMs) > 1500);
+
+	for (int i = 0; i < 60; i++) {
+		zassert_equal(link.Exchange(estimator), 0);
+	}
+
+	zassert_within(estimator.SrttMs(), 1500, 10);
+}
+
+ZTEST_SUITE(rtt_estimator, NULL, NULL, NULL, NULL, NULL);
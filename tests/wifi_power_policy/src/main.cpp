@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "wifi_power_policy.h"
+
+#include <zephyr/ztest.h>
+
+#include <errno.h>
+
+namespace {
+
+constexpr WifiPowerPolicy::Config kConfig = { 8192, 1000, 60000, 102400, 100, 20 };
+
+/* Wi-Fi management stub recording the requests of the policy. */
+class StubWifiBackend : public WifiPowerBackend {
+public:
+	int SetupTwt(uint8_t flowId, uint64_t intervalUs, uint32_t wakeDurationUs) override
+	{
+		mSetups++;
+		mFlowId = flowId;
+		mTwtIntervalUs = intervalUs;
+		mWakeDurationUs = wakeDurationUs;
+		return mSetupError;
+	}
+
+	int TeardownTwt(uint8_t flowId) override
+	{
+		mTeardowns++;
+		mTeardownFlowId = flowId;
+		return 0;
+	}
+
+	int SetListenInterval(uint16_t beacons) override
+	{
+		mListenIntervalCalls++;
+		mListenInterval = beacons;
+		return mListenIntervalError;
+	}
+
+	int mSetupError{ 0 };
+	int mListenIntervalError{ 0 };
+	uint32_t mSetups{ 0 };
+	uint32_t mTeardowns{ 0 };
+	uint32_t mListenIntervalCalls{ 0 };
+	uint8_t mFlowId{ 0 };
+	uint8_t mTeardownFlowId{ 0 };
+	uint64_t mTwtIntervalUs{ 0 };
+	uint32_t mWakeDurationUs{ 0 };
+	uint16_t mListenInterval{ 0 };
+};
+
+} /* namespace */
+
+ZTEST(wifi_power_policy, test_twt_accepted)
+{
+	StubWifiBackend backend;
+	WifiPowerPolicy policy(backend, kConfig);
+
+	policy.OnConnected(10000);
+
+	/* The request was only sent, the mode changes with the response. */
+	zassert_equal(backend.mSetups, 1);
+	zassert_equal(backend.mTwtIntervalUs, 10000000);
+	zassert_equal(backend.mWakeDurationUs, 8192);
+	zassert_equal(policy.GetMode(), WifiPowerPolicy::Mode::TwtPending);
+
+	policy.OnTwtSetupResult(backend.mFlowId, true);
+
+	zassert_equal(policy.GetMode(), WifiPowerPolicy::Mode::Twt);
+	zassert_equal(policy.GetIntervalMs(), 10000);
+	zassert_equal(backend.mListenIntervalCalls, 0);
+}
+
+ZTEST(wifi_power_policy, test_twt_rejected)
+{
+	StubWifiBackend backend;
+	WifiPowerPolicy policy(backend, kConfig);
+
+	policy.OnConnected(5000);
+	policy.OnTwtSetupResult(backend.mFlowId, false);
+
+	/* 5 s is 48 beacon intervals of 102.4 ms. */
+	zassert_equal(policy.GetMode(), WifiPowerPolicy::Mode::ListenInterval);
+	zassert_equal(backend.mListenInterval, 48);
+	zassert_equal(policy.GetIntervalMs(), 4915);
+	zassert_equal(policy.TwtFailures(), 1);
+
+	/* TWT is not requested again from the same access point. */
+	policy.OnSamplePeriodChanged(20000);
+	zassert_equal(backend.mSetups, 1);
+	zassert_equal(backend.mListenInterval, 100);
+}
+
+ZTEST(wifi_power_policy, test_twt_request_not_sent)
+{
+	StubWifiBackend backend;
+	WifiPowerPolicy policy(backend, kConfig);
+
+	backend.mSetupError = -ENOTSUP;
+	policy.OnConnected(5000);
+
+	zassert_equal(policy.GetMode(), WifiPowerPolicy::Mode::ListenInterval);
+	zassert_equal(policy.TwtFailures(), 1);
+}
+
+ZTEST(wifi_power_policy, test_stale_response_ignored)
+{
+	StubWifiBackend backend;
+	WifiPowerPolicy policy(backend, kConfig);
+
+	policy.OnConnected(10000);
+	uint8_t firstFlowId = backend.mFlowId;
+	policy.OnTwtSetupResult(firstFlowId, true);
+
+	policy.OnSamplePeriodChanged(30000);
+	zassert_equal(backend.mTeardowns, 1);
+	zassert_equal(backend.mTeardownFlowId, firstFlowId);
+	zassert_not_equal(backend.mFlowId, firstFlowId);
+	zassert_equal(policy.GetMode(), WifiPowerPolicy::Mode::TwtPending);
+
+	/* A late answer for the previous flow does not complete the new negotiation. */
+	policy.OnTwtSetupResult(firstFlowId, false);
+	zassert_equal(policy.GetMode(), WifiPowerPolicy::Mode::TwtPending);
+
+	policy.OnTwtSetupResult(backend.mFlowId, true);
+	zassert_equal(policy.GetMode(), WifiPowerPolicy::Mode::Twt);
+	zassert_equal(policy.GetIntervalMs(), 30000);
+}
+
+ZTEST(wifi_power_policy, test_teardown_by_access_point)
+{
+	StubWifiBackend backend;
+	WifiPowerPolicy policy(backend, kConfig);
+
+	policy.OnConnected(10000);
+	policy.OnTwtSetupResult(backend.mFlowId, true);
+	policy.OnTwtTeardown(backend.mFlowId);
+
+	zassert_equal(policy.GetMode(), WifiPowerPolicy::Mode::ListenInterval);
+	zassert_equal(backend.mListenInterval, 97);
+}
+
+ZTEST(wifi_power_policy, test_period_change_while_pending)
+{
+	StubWifiBackend backend;
+	WifiPowerPolicy policy(backend, kConfig);
+
+	policy.OnConnected(10000);
+	policy.OnSamplePeriodChanged(40000);
+	zassert_equal(backend.mSetups, 1);
+
+	/* The agreement no longer matches the sample period once accepted, it is renegotiated. */
+	policy.OnTwtSetupResult(backend.mFlowId, true);
+	zassert_equal(backend.mSetups, 2);
+	zassert_equal(backend.mTwtIntervalUs, 40000000);
+	zassert_equal(policy.Renegotiations(), 1);
+}
+
+ZTEST(wifi_power_policy, test_threshold)
+{
+	StubWifiBackend backend;
+	WifiPowerPolicy policy(backend, kConfig);
+
+	policy.OnConnected(10000);
+	policy.OnTwtSetupResult(backend.mFlowId, true);
+
+	policy.OnSamplePeriodChanged(11000);
+	zassert_equal(backend.mSetups, 1);
+	zassert_equal(policy.Renegotiations(), 0);
+
+	policy.OnSamplePeriodChanged(13000);
+	zassert_equal(backend.mSetups, 2);
+	zassert_equal(policy.Renegotiations(), 1);
+}
+
+ZTEST(wifi_power_policy, test_interval_bounds)
+{
+	StubWifiBackend backend;
+	WifiPowerPolicy policy(backend, kConfig);
+
+	policy.OnConnected(100);
+	zassert_equal(backend.mTwtIntervalUs, 1000000);
+
+	policy.OnDisconnected();
+	policy.OnConnected(3600000);
+	zassert_equal(backend.mTwtIntervalUs, 60000000);
+}
+
+ZTEST(wifi_power_policy, test_dtim_fallback)
+{
+	StubWifiBackend backend;
+	WifiPowerPolicy policy(backend, kConfig);
+
+	backend.mListenIntervalError = -EIO;
+	policy.OnConnected(5000);
+	policy.OnTwtSetupResult(backend.mFlowId, false);
+
+	zassert_equal(policy.GetMode(), WifiPowerPolicy::Mode::Dtim);
+	zassert_equal(backend.mListenInterval, 0);
+}
+
+ZTEST(wifi_power_policy, test_reconnect_retries_twt)
+{
+	StubWifiBackend backend;
+	WifiPowerPolicy policy(backend, kConfig);
+
+	policy.OnConnected(10000);
+	policy.OnTwtSetupResult(backend.mFlowId, false);
+	policy.OnDisconnected();
+
+	zassert_equal(policy.GetMode(), WifiPowerPolicy::Mode::Dtim);
+
+	/* A result arriving after the disconnection is ignored. */
+	policy.OnTwtSetupResult(backend.mFlowId, true);
+	zassert_equal(policy.GetMode(), WifiPowerPolicy::Mode::Dtim);
+
+	policy.OnConnected(10000);
+	zassert_equal(backend.mSetups, 2);
+	zassert_equal(policy.GetMode(), WifiPowerPolicy::Mode::TwtPending);
+}
+
+ZTEST_SUITE(wifi_power_policy, NULL, NULL, NULL, NULL, NULL);